@@ -15,7 +15,6 @@
 #include "../../nlohmann/json.hpp"
 #include "../../utils/log.hpp"
 #include "system/path.hpp"
-#include "../model/evolutions.hpp"
 #include "src/utils/OptionsSave.hpp"
 #include "src/utils/ResourceLoader.hpp"
 #include "src/utils/KeyData.hpp"
@@ -74,53 +73,7 @@ GameData::GameData() {
 
 	Utils::ResourceLoader::load(font, "fonts/Default.ttf", true);
 
-	for(std::filesystem::directory_entry const& file : std::filesystem::directory_iterator(Path::getResourcePath() + "data/species")) {
-		if(file.is_regular_file()){
-			std::ifstream opmonJsonFile(file.path());
-			if(!opmonJsonFile) {
-				throw Utils::LoadingException(Path::getResourcePath() + "data/opmon.json", true);
-			}
-			nlohmann::json opmonJson;
-			opmonJsonFile >> opmonJson;
-
-			for(auto itor = opmonJson.begin(); itor != opmonJson.end(); ++itor) {
-				int opDexNumber = itor->at("opDex");
-				std::string opDexNumberStr = std::to_string(opDexNumber);
-
-				Evolution *evol = nullptr;
-				if(itor->at("evolution").at("type") == "level") {
-					evol = new E_Level(itor->at("evolution").at("species"), itor->at("evolution").at("level"));
-				} else if(itor->at("evolution").at("type") == "no") {
-					evol = nullptr;
-				}
-				std::vector<Stats> evs;
-				for(unsigned int i = 0; i < itor->at("evs").size(); ++i) {
-					evs.push_back(itor->at("evs")[i]);
-				}
-
-				listOp.emplace(opDexNumber, new Species(itor->at("atk"),
-						itor->at("def"),
-						itor->at("atkSpe"),
-						itor->at("defSpe"),
-						itor->at("spe"),
-						itor->at("HP"),
-						getStringKeys().getStd("opmon.name." + opDexNumberStr),
-						itor->at("types")[0],
-						itor->at("types")[1],
-						evol,
-						evs,
-						itor->at("height"),
-						itor->at("weight"),
-						getStringKeys().getStd("opmon.desc." + opDexNumberStr),
-						itor->at("expGiven"),
-						itor->at("curve"),
-						itor->at("captureRate"),
-						opDexNumber));
-				Utils::Log::oplog("Loaded OpMon n°" + opDexNumberStr + " : " + listOp[opDexNumber]->getName());
-			}
-		}
-	}
-
+	Species::initSpecies(std::filesystem::directory_iterator(Path::getResourcePath() + "data/species"), listOp);
 
 	//Initializating OpMon Sprites
 
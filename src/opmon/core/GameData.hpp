@@ -79,6 +79,10 @@ class Species;
          * \brief Gets a pointer to a Species object.
          */
         Species *getOp(unsigned int id) { return listOp.at(id); }
+        /*!
+         * \brief Gets all the species, indexed by their Opdex number.
+         */
+        std::map<unsigned int, Species *> const &getSpeciesList() const { return listOp; }
         /*!
          * \brief Gets the texture of a type.
          */
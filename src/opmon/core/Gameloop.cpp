@@ -10,11 +10,14 @@ File under GNU GPL v3.0 license
 #include <SFML/Graphics/Text.hpp>
 #include <SFML/Graphics/Texture.hpp>
 #include <SFML/Window/Event.hpp>
-#include <SFML/Graphics/RenderTexture.hpp>
+#include <SFML/Graphics/RenderTarget.hpp>
 #include <SFML/Graphics/RenderWindow.hpp>
+#include <SFML/System/Sleep.hpp>
+#include <SFML/System/Time.hpp>
 #include <functional>
 #include <algorithm>
 #include <utility>
+#include <string>
 
 #include "../../utils/StringKeys.hpp"
 #include "../screens/mainmenu/MainMenuCtrl.hpp"
@@ -25,12 +28,19 @@ File under GNU GPL v3.0 license
 #include "src/opmon/view/ui/Window.hpp"
 #include "src/utils/exceptions.hpp"
 
+//Maximum time waited for an event on a screen which isn't animating, in milliseconds
+#define IDLE_WAIT_MS 250
+//Time between two checks of the keyboard in frame by frame mode, in milliseconds
+#define FBF_POLL_MS 5
+//Number of screens on the top of the stack keeping their resources loaded
+#define LOADED_SCREENS 2
+
 namespace OpMon {
 
     GameLoop::GameLoop()
       : gamedata(std::make_unique<GameData>()) {
         std::unique_ptr<AGameScreen> firstCtrl = std::make_unique<MainMenuCtrl>(gamedata.get());
-        _gameScreens.push(std::move(firstCtrl));
+        _gameScreens.push_back(std::move(firstCtrl));
     }
 
     GameStatus GameLoop::operator()() {
@@ -48,31 +58,52 @@ namespace OpMon {
         loadingTxt.setFont(gamedata->getFont());
         loadingTxt.setCharacterSize(35);
 
-        window->getFrame().clear(sf::Color(74, 81, 148));
-        window->getFrame().draw(loadingTxt);
+        window->getTarget().clear(sf::Color(74, 81, 148));
+        window->getTarget().draw(loadingTxt);
         window->refresh();
 
+        const sf::String loadingStr = loadingTxt.getString();
+
         GameStatus status{GameStatus::CONTINUE};
 
         while(status != GameStatus::STOP && status != GameStatus::REBOOT) {
             try {
                 status = GameStatus::CONTINUE;
 
+                //While the next screen is built in the background, only the window events and the loading screen are handled
+                if(loader.isLoading()) {
+                    status = _checkLoading(*window, loadingTxt, loadingStr);
+                    continue;
+                }
+
                 //Debug frame by frame
                 while(sf::Keyboard::isKeyPressed(sf::Keyboard::F2) && !(sf::Keyboard::isKeyPressed(fbfType) && hasBeenReleased)) {
                     if(!sf::Keyboard::isKeyPressed(fbfType)) {
                         hasBeenReleased = true;
                     }
+                    //Sleeps between two checks of the keyboard instead of spinning
+                    sf::sleep(sf::milliseconds(FBF_POLL_MS));
                 }
                 hasBeenReleased = false;
 
                 //Gets the current game screen's controller
-                auto *ctrl = _gameScreens.top().get();
+                auto *ctrl = _gameScreens.back().get();
                 sf::Event event;
 
+                //A screen which isn't animating doesn't change until an event happens: the loop waits for one instead of drawing the same frame again
+                bool pendingEvent = false;
+                if(!ctrl->isAnimating() && !redrawNeeded) {
+                    if(!window->waitEvent(event, sf::milliseconds(IDLE_WAIT_MS))) {
+                        continue;
+                    }
+                    pendingEvent = true;
+                }
+                redrawNeeded = false;
+
                 //process all pending SFML events
                 while(status == GameStatus::CONTINUE) {
-                    bool isEvent = window->getWindow().pollEvent(event);
+                    bool isEvent = pendingEvent || window->getWindow().pollEvent(event);
+                    pendingEvent = false;
                     if(isEvent == false)
                         event.type = sf::Event::SensorChanged;
                     _checkWindowResize(event, *window);
@@ -88,34 +119,34 @@ namespace OpMon {
                 if(status == GameStatus::WIN_REBOOT) {
                     window->reboot(gamedata->getOptions());
                     status = GameStatus::CONTINUE;
+                    redrawNeeded = true;
                 }
 
                 if(status == GameStatus::CONTINUE) {
                     // frame update & draw
-                    status = ctrl->update(window->getFrame());
+                    status = ctrl->update(window->getTarget());
                 }
 
-                if(status == GameStatus::NEXT || status == GameStatus::PREVIOUS || status == GameStatus::NEXT_NLS || status == GameStatus::PREVIOUS_NLS) {
-                    if(status == GameStatus::NEXT) {
-                        window->getFrame().clear(sf::Color(74, 81, 148));
-                        window->getFrame().draw(loadingTxt);
-                        window->refresh();
-                    } else {
-                        status = ((status == GameStatus::NEXT_NLS) ? GameStatus::NEXT : GameStatus::PREVIOUS);
-                    }
-                    if(status == GameStatus::NEXT) {
-                        ctrl->loadNextScreen();
-                    }
+                if(status == GameStatus::NEXT) {
+                    //The next screen is loaded in the background, the loading screen is shown until it is ready
+                    loadingFrames = 0;
+                    loader.start(*ctrl);
+                    status = GameStatus::CONTINUE;
+                    continue;
+                }
+                if(status == GameStatus::NEXT_NLS) {
+                    ctrl->loadNextScreen();
+                    status = GameStatus::NEXT;
+                } else if(status == GameStatus::PREVIOUS_NLS) {
+                    status = GameStatus::PREVIOUS;
                 }
 
                 switch(status) {
                 case GameStatus::NEXT: //Pauses the current screen and passes to the next
-                    ctrl->suspend();
-                    _gameScreens.push(ctrl->getNextGameScreen());
+                    _pushScreen(ctrl->getNextGameScreen());
                     break;
                 case GameStatus::PREVIOUS: //Deletes the current screen and returns to the previous one
-                    _gameScreens.pop();
-                    _gameScreens.top()->resume();
+                    _popScreen();
                     break;
                 case GameStatus::CONTINUE:
                     window->refresh();
@@ -140,6 +171,47 @@ namespace OpMon {
         return status;
     }
 
+    GameStatus GameLoop::_checkLoading(Ui::Window &window, sf::Text &loadingTxt, sf::String const &loadingStr) {
+        sf::Event event;
+        while(window.getWindow().pollEvent(event)) {
+            _checkWindowResize(event, window);
+            if(_checkQuit(event) == GameStatus::STOP) {
+                return GameStatus::STOP;
+            }
+        }
+
+        if(loader.isReady()) {
+            _pushScreen(loader.finish());
+            return GameStatus::CONTINUE;
+        }
+
+        //Animates the loading text with up to three dots
+        loadingTxt.setString(loadingStr + sf::String(std::string((loadingFrames++ / 10) % 4, '.')));
+        window.getTarget().clear(sf::Color(74, 81, 148));
+        window.getTarget().draw(loadingTxt);
+        window.refresh();
+        return GameStatus::CONTINUE;
+    }
+
+    void GameLoop::_pushScreen(std::unique_ptr<AGameScreen> screen) {
+        redrawNeeded = true;
+        if(!screen) {
+            return;
+        }
+        _gameScreens.back()->suspend();
+        _gameScreens.push_back(std::move(screen));
+        if(_gameScreens.size() > LOADED_SCREENS) {
+            _gameScreens[_gameScreens.size() - 1 - LOADED_SCREENS]->release();
+        }
+    }
+
+    void GameLoop::_popScreen() {
+        _gameScreens.pop_back();
+        _gameScreens.back()->restore();
+        _gameScreens.back()->resume();
+        redrawNeeded = true;
+    }
+
     GameStatus GameLoop::_checkQuit(const sf::Event &event) {
         if(event.type == sf::Event::Closed || sf::Keyboard::isKeyPressed(sf::Keyboard::Escape)) {
             return GameStatus::STOP;
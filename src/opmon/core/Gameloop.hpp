@@ -16,13 +16,16 @@
 
 #pragma once
 
-#include <stack>
+#include <vector>
 
 #include "../screens/base/AGameScreen.hpp"
 #include "GameData.hpp"
+#include "ScreenLoader.hpp"
 
 namespace sf {
 class Event;
+class String;
+class Text;
 }  // namespace sf
 
 namespace OpMon {
@@ -59,6 +62,28 @@ class Window;
          */
         void _checkWindowResize(const sf::Event &event, Ui::Window &window) const;
 
+        /*!
+         * \brief Runs one frame while the next screen is being loaded by GameLoop::loader.
+         * \details Handles the window events, draws the animated loading screen and pushes the new screen on the stack once it is ready.
+         * \param window The game window.
+         * \param loadingTxt The text drawn on the loading screen.
+         * \param loadingStr The text of the loading screen without the animated dots.
+         * \return GameStatus::STOP if the game has been closed during the loading, GameStatus::CONTINUE otherwise.
+         */
+        GameStatus _checkLoading(Ui::Window &window, sf::Text &loadingTxt, sf::String const &loadingStr);
+
+        /*!
+         * \brief Suspends the current screen and pushes a new one on the stack.
+         * \details The screen which is now LOADED_SCREENS screens below the top releases its resources.
+         * If `screen` is empty, because the current screen couldn't load its next screen, the current screen stays.
+         */
+        void _pushScreen(std::unique_ptr<AGameScreen> screen);
+
+        /*!
+         * \brief Deletes the current screen and resumes the previous one, restoring its resources if needed.
+         */
+        void _popScreen();
+
     private:
         /*!
          * \brief The pointer containing the GameData object shared in the different data objects.
@@ -66,8 +91,9 @@ class Window;
         std::unique_ptr<GameData> gamedata;
         /*!
          * \brief The stack of game screens.
+         * \details The top of the stack is the last element. A vector is used to access the screens under the top one, to release their resources.
          */
-        std::stack<std::unique_ptr<AGameScreen>> _gameScreens;
+        std::vector<std::unique_ptr<AGameScreen>> _gameScreens;
         /*!
          * \brief If `true`, the game executes itself frame by frame.
          * \details This mode is activated my keeping the F2 key pressed. On release, the mode is disabled. One frame can be passed by pressing the key registered in `fbfType`.
@@ -85,6 +111,20 @@ class Window;
          * \brief Counts the number of times a frame has been skipped because of an exception.
          */
         int frameskips = 0;
+        /*!
+         * \brief Loads the next screen in the background when the current one returns GameStatus::NEXT.
+         * \details Declared after GameLoop::_gameScreens so the loading is over before the screens are destroyed.
+         */
+        ScreenLoader loader;
+        /*!
+         * \brief Number of frames drawn since the start of the current loading, used to animate the loading screen.
+         */
+        unsigned int loadingFrames = 0;
+        /*!
+         * \brief If `true`, the next frame is drawn even if the current screen isn't animating.
+         * \details Set when the screen on the top of the stack changes or when the window is rebooted, since the window content is outdated.
+         */
+        bool redrawNeeded = true;
     };
 
 } // namespace OpMon
@@ -0,0 +1,43 @@
+/*
+ScreenLoader.cpp
+Author : Cyrielle
+File under GNU GPL v3.0 license
+*/
+#include "ScreenLoader.hpp"
+
+#include <SFML/Window/Context.hpp>
+#include <chrono>
+
+namespace OpMon {
+
+    ScreenLoader::~ScreenLoader() {
+        if(task.valid()) {
+            task.wait();
+        }
+    }
+
+    void ScreenLoader::start(AGameScreen &from) {
+        this->from = &from;
+        task = std::async(std::launch::async, [&from]() {
+            //The textures loaded by the next screen need an OpenGL context in this thread.
+            sf::Context context;
+            from.loadNextScreen();
+        });
+    }
+
+    bool ScreenLoader::isLoading() const {
+        return task.valid();
+    }
+
+    bool ScreenLoader::isReady() const {
+        return task.valid() && task.wait_for(std::chrono::seconds(0)) == std::future_status::ready;
+    }
+
+    std::unique_ptr<AGameScreen> ScreenLoader::finish() {
+        AGameScreen *loaded = from;
+        from = nullptr;
+        task.get();
+        return loaded->getNextGameScreen();
+    }
+
+} // namespace OpMon
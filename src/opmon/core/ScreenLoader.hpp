@@ -0,0 +1,63 @@
+/*!
+ * \file ScreenLoader.hpp
+ * \author Cyrielle
+ * \copyright GNU GPL v3.0
+ */
+#pragma once
+
+#include <future>
+#include <memory>
+
+#include "../screens/base/AGameScreen.hpp"
+
+namespace OpMon {
+
+    /*!
+     * \brief Builds the next game screen in the background.
+     * \details When a screen returns GameStatus::NEXT, GameLoop gives it to a ScreenLoader, which calls AGameScreen::loadNextScreen() on a worker thread. Meanwhile, the game loop keeps handling the window events and drawing the loading screen. Once isReady() returns `true`, finish() gives the new screen, ready to be pushed on the stack.
+     *
+     * The screen given to start() must not be updated nor receive events until finish() has been called.
+     */
+    class ScreenLoader {
+      public:
+        ScreenLoader() = default;
+        /*!
+         * \brief Waits for the worker thread if a screen is still being loaded.
+         */
+        ~ScreenLoader();
+
+        /*!
+         * \brief Starts loading the screen following the given one.
+         * \param from The screen whose loadNextScreen() method has to be called.
+         */
+        void start(AGameScreen &from);
+
+        /*!
+         * \returns `true` if a screen is being loaded, or is loaded but has not been retrieved with finish() yet.
+         */
+        bool isLoading() const;
+
+        /*!
+         * \returns `true` if the screen has been loaded and can be retrieved with finish() without waiting.
+         */
+        bool isReady() const;
+
+        /*!
+         * \brief Waits for the end of the loading and returns the new screen.
+         * \details If an exception has been thrown by loadNextScreen() in the worker thread, it is thrown again here.
+         * \returns The screen loaded by the screen given to start().
+         */
+        std::unique_ptr<AGameScreen> finish();
+
+      private:
+        /*!
+         * \brief The screen which is loading its next screen.
+         */
+        AGameScreen *from = nullptr;
+        /*!
+         * \brief The task running AGameScreen::loadNextScreen() on the worker thread.
+         */
+        std::future<void> task;
+    };
+
+} // namespace OpMon
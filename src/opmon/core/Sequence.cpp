@@ -0,0 +1,131 @@
+/*
+Sequence.cpp
+Author : Cyrielle
+File under GNU GPL v3.0 license
+*/
+#include "Sequence.hpp"
+
+#include <algorithm>
+#include <new>
+
+/*!
+ * \brief The sizes of the coroutine frames are rounded up to a multiple of this value.
+ */
+#define FRAME_SIZE_STEP 64
+/*!
+ * \brief The number of size classes of the frame pool. Bigger frames are directly allocated on the heap.
+ */
+#define FRAME_SIZE_CLASSES 16
+
+namespace OpMon {
+
+    namespace {
+        /*!
+         * \brief Keeps the freed coroutine frames to reuse them, with one free list per size class.
+         */
+        struct FramePool {
+            std::vector<void *> freeFrames[FRAME_SIZE_CLASSES];
+
+            ~FramePool() {
+                for(std::vector<void *> &frames : freeFrames) {
+                    for(void *frame : frames) {
+                        ::operator delete(frame);
+                    }
+                }
+            }
+        };
+
+        thread_local FramePool framePool;
+    } // namespace
+
+    void *Sequence::promise_type::operator new(std::size_t size) {
+        std::size_t sizeClass = (size - 1) / FRAME_SIZE_STEP;
+        if(sizeClass >= FRAME_SIZE_CLASSES) {
+            return ::operator new(size);
+        }
+        std::vector<void *> &frames = framePool.freeFrames[sizeClass];
+        if(frames.empty()) {
+            return ::operator new((sizeClass + 1) * FRAME_SIZE_STEP);
+        }
+        void *frame = frames.back();
+        frames.pop_back();
+        return frame;
+    }
+
+    void Sequence::promise_type::operator delete(void *ptr, std::size_t size) {
+        std::size_t sizeClass = (size - 1) / FRAME_SIZE_STEP;
+        if(sizeClass >= FRAME_SIZE_CLASSES) {
+            ::operator delete(ptr);
+        } else {
+            framePool.freeFrames[sizeClass].push_back(ptr);
+        }
+    }
+
+    Sequence::~Sequence() {
+        if(handle) {
+            handle.destroy();
+        }
+    }
+
+    Signal::~Signal() {
+        for(Awaiter *awaiter : waiting) {
+            awaiter->signal = nullptr;
+        }
+    }
+
+    void Signal::notify() {
+        for(Awaiter *awaiter : waiting) {
+            awaiter->signal = nullptr;
+            awaiter->handle.promise().scheduler->schedule(awaiter->handle);
+        }
+        waiting.clear();
+    }
+
+    Signal::Awaiter::~Awaiter() {
+        if(signal != nullptr && handle) {
+            signal->waiting.erase(std::find(signal->waiting.begin(), signal->waiting.end(), this));
+        }
+    }
+
+    SequenceScheduler::~SequenceScheduler() {
+        //Destroying the frames also removes the waiting sequences from their signals (see Signal::Awaiter::~Awaiter).
+        for(Sequence::Handle handle : sequences) {
+            handle.destroy();
+        }
+    }
+
+    void SequenceScheduler::start(Sequence sequence) {
+        Sequence::Handle handle = sequence.handle;
+        sequence.handle = nullptr;
+        handle.promise().scheduler = this;
+        sequences.push_back(handle);
+        resume(handle);
+    }
+
+    void SequenceScheduler::schedule(Sequence::Handle handle) {
+        ready.push_back(handle);
+    }
+
+    void SequenceScheduler::tick() {
+        ticks++;
+        while(!timers.empty() && timers.top().tick <= ticks) {
+            ready.push_back(timers.top().handle);
+            timers.pop();
+        }
+        //The sequences resumed here can schedule other sequences, which will be resumed in the next tick.
+        resuming.swap(ready);
+        for(Sequence::Handle handle : resuming) {
+            resume(handle);
+        }
+        resuming.clear();
+    }
+
+    void SequenceScheduler::resume(Sequence::Handle handle) {
+        handle.resume();
+        if(handle.done()) {
+            sequences.erase(std::find(sequences.begin(), sequences.end(), handle));
+            handle.destroy();
+        }
+    }
+
+} // namespace OpMon
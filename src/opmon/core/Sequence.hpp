@@ -0,0 +1,216 @@
+/*!
+ * \file Sequence.hpp
+ * \author Cyrielle
+ * \copyright GNU GPL v3.0
+ */
+#pragma once
+
+#include <coroutine>
+#include <cstddef>
+#include <functional>
+#include <queue>
+#include <vector>
+
+namespace OpMon {
+
+    class SequenceScheduler;
+
+    /*!
+     * \brief A coroutine driven by the game ticks, used to write sequences of actions (cutscenes, trainers...) linearly.
+     * \details A function returning a Sequence can use `co_await` on a Signal or on SequenceScheduler::wait to wait for something to happen.
+     * The sequence does nothing until it is given to SequenceScheduler::start. The scheduler then owns the coroutine, and destroys it when it ends.
+     *
+     * The frames of the coroutines are allocated in a pool, so starting a sequence usually doesn't allocate memory.
+     */
+    class Sequence {
+      public:
+        struct promise_type {
+            /*!
+             * \brief The scheduler resuming the sequence.
+             */
+            SequenceScheduler *scheduler = nullptr;
+
+            Sequence get_return_object() {
+                return Sequence(std::coroutine_handle<promise_type>::from_promise(*this));
+            }
+            std::suspend_always initial_suspend() noexcept {
+                return {};
+            }
+            std::suspend_always final_suspend() noexcept {
+                return {};
+            }
+            void return_void() {}
+            void unhandled_exception() {
+                throw;
+            }
+
+            static void *operator new(std::size_t size);
+            static void operator delete(void *ptr, std::size_t size);
+        };
+        typedef std::coroutine_handle<promise_type> Handle;
+
+        Sequence(Sequence &&other) noexcept
+          : handle(other.handle) {
+            other.handle = nullptr;
+        }
+        Sequence(Sequence const &) = delete;
+        Sequence &operator=(Sequence const &) = delete;
+        /*!
+         * \brief Destroys the coroutine if it has not been given to a scheduler.
+         */
+        ~Sequence();
+
+      private:
+        friend class SequenceScheduler;
+
+        explicit Sequence(Handle handle)
+          : handle(handle) {}
+
+        Handle handle;
+    };
+
+    /*!
+     * \brief Something a Sequence can wait for with `co_await`.
+     * \details The sequences waiting for the signal are not resumed by notify() directly : they are given to their scheduler, which resumes them in its next tick. A waiting sequence costs nothing until then.
+     *
+     * The signal and the waiting sequences can be destroyed in any order : a sequence destroyed while waiting (for example by the destructor of its scheduler) is removed from the signal, and a destroyed signal is forgotten by the sequences waiting for it, which then never resume.
+     */
+    class Signal {
+      public:
+        Signal() = default;
+        Signal(Signal const &) = delete;
+        Signal &operator=(Signal const &) = delete;
+        ~Signal();
+
+        /*!
+         * \brief Wakes up the sequences waiting for the signal.
+         */
+        void notify();
+
+        /*!
+         * \brief The object a sequence waits on. It lives in the coroutine frame while the sequence waits, so it is destroyed with the frame.
+         */
+        class Awaiter {
+          public:
+            explicit Awaiter(Signal &signal)
+              : signal(&signal) {}
+            Awaiter(Awaiter const &) = delete;
+            Awaiter &operator=(Awaiter const &) = delete;
+            /*!
+             * \brief Removes the sequence from the signal if it is still waiting.
+             */
+            ~Awaiter();
+
+            bool await_ready() const noexcept {
+                return false;
+            }
+            void await_suspend(Sequence::Handle handle) {
+                this->handle = handle;
+                signal->waiting.push_back(this);
+            }
+            void await_resume() const noexcept {}
+
+          private:
+            friend class Signal;
+
+            /*!
+             * \brief The signal, or `nullptr` if the sequence is not waiting for it anymore.
+             */
+            Signal *signal;
+            Sequence::Handle handle;
+        };
+
+        Awaiter operator co_await() {
+            return Awaiter(*this);
+        }
+
+      private:
+        std::vector<Awaiter *> waiting;
+    };
+
+    /*!
+     * \brief Runs the sequences.
+     * \details tick() has to be called once per frame. The sequences are only resumed during tick(), so they always run at the same point of the frame.
+     */
+    class SequenceScheduler {
+      public:
+        SequenceScheduler() = default;
+        SequenceScheduler(SequenceScheduler const &) = delete;
+        SequenceScheduler &operator=(SequenceScheduler const &) = delete;
+        /*!
+         * \brief Destroys the sequences which are not over.
+         */
+        ~SequenceScheduler();
+
+        /*!
+         * \brief Starts a sequence, which runs until its first `co_await`.
+         */
+        void start(Sequence sequence);
+
+        /*!
+         * \brief Makes a waiting sequence resume in the next tick.
+         */
+        void schedule(Sequence::Handle handle);
+
+        /*!
+         * \brief Resumes the sequences which are ready, and destroys the ones which are over.
+         */
+        void tick();
+
+        unsigned long getTicks() const {
+            return ticks;
+        }
+
+        struct WaitAwaiter {
+            SequenceScheduler &scheduler;
+            unsigned int count;
+            bool await_ready() const noexcept {
+                return count == 0;
+            }
+            void await_suspend(Sequence::Handle handle) {
+                scheduler.timers.push(Timer{scheduler.ticks + count, handle});
+            }
+            void await_resume() const noexcept {}
+        };
+
+        /*!
+         * \brief Returns an awaitable making a sequence wait for the given number of ticks.
+         */
+        WaitAwaiter wait(unsigned int count) {
+            return WaitAwaiter{*this, count};
+        }
+
+      private:
+        struct Timer {
+            unsigned long tick;
+            Sequence::Handle handle;
+            bool operator>(Timer const &other) const {
+                return tick > other.tick;
+            }
+        };
+
+        /*!
+         * \brief Resumes a sequence, and destroys it if it is over.
+         */
+        void resume(Sequence::Handle handle);
+
+        unsigned long ticks = 0;
+        /*!
+         * \brief The sequences started and not over yet.
+         */
+        std::vector<Sequence::Handle> sequences;
+        /*!
+         * \brief The sequences to resume in the next tick.
+         */
+        std::vector<Sequence::Handle> ready;
+        /*!
+         * \brief The sequences being resumed by tick(). Kept as a member to reuse its memory.
+         */
+        std::vector<Sequence::Handle> resuming;
+        /*!
+         * \brief The sequences waiting for a tick, the earliest first.
+         */
+        std::priority_queue<Timer, std::vector<Timer>, std::greater<Timer>> timers;
+    };
+
+} // namespace OpMon
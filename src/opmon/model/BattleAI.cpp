@@ -0,0 +1,189 @@
+/*
+BattleAI.cpp
+Author : Cyrielle
+File under GNU GPL v3.0 license
+*/
+#include "BattleAI.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <limits>
+#include <random>
+
+#include "../../utils/misc.hpp"
+
+/*!
+ * \brief The number of times each pair of moves is resolved to estimate the outcome of a turn.
+ */
+#define AI_CHANCE_SAMPLES 4
+/*!
+ * \brief The value of a won battle. The other states are valued between -1 and 1.
+ */
+#define AI_WIN_VALUE 2.0
+
+namespace OpMon {
+
+    namespace {
+        /*!
+         * \brief The data shared by the nodes of a search.
+         */
+        struct Search {
+            /*!
+             * \brief The combatant for which the choice is searched.
+             */
+            int side;
+            std::chrono::steady_clock::time_point deadline;
+            /*!
+             * \brief Gives the seeds of the chance nodes.
+             */
+            std::minstd_rand random;
+            BattleLog log;
+            bool timeout = false;
+        };
+
+        /*!
+         * \brief Estimates how good a state is for the team of a combatant.
+         */
+        double evaluate(BattleState const &state, int side) {
+            int team = state.combatants[side].team;
+            if(BattleEngine::isOver(state)) {
+                return BattleEngine::getWinner(state) == team ? AI_WIN_VALUE : -AI_WIN_VALUE;
+            }
+            double value = 0;
+            for(int i = 0; i < state.count; i++) {
+                Combatant const &combatant = state.combatants[i];
+                value += (combatant.team == team ? 1.0 : -1.0) * combatant.hp / combatant.maxHp;
+            }
+            return value;
+        }
+
+        /*!
+         * \brief Gives to all the combatants their first usable move, on their first opponent.
+         * \details In the search, only the searching combatant and its target choose their moves : the others are assumed to do this.
+         */
+        void defaultChoices(BattleState const &state, BattleChoice choices[]) {
+            for(int i = 0; i < state.count; i++) {
+                int moves[4];
+                int target = BattleEngine::getTarget(state, i, -1);
+                if(BattleEngine::listMoves(state.combatants[i], moves) > 0) {
+                    choices[i] = {Elements::TurnType::MOVE, moves[0], target};
+                } else {
+                    choices[i] = {Elements::TurnType::CHANGE, 0, target};
+                }
+            }
+        }
+
+        double decide(BattleState const &state, int depth, Search &search);
+
+        /*!
+         * \brief Returns the expected value of a turn, estimated by resolving it with several seeds.
+         */
+        double resolve(BattleState const &state, BattleChoice const choices[], int depth, Search &search) {
+            double total = 0;
+            for(int i = 0; i < AI_CHANCE_SAMPLES; i++) {
+                BattleState next = state;
+                next.random = ((std::uint64_t)search.random() << 32) | search.random();
+                if(BattleEngine::resolveTurn(next, choices, search.log) || depth <= 1) {
+                    total += evaluate(next, search.side);
+                } else {
+                    total += decide(next, depth - 1, search);
+                }
+                if(search.timeout || std::chrono::steady_clock::now() > search.deadline) {
+                    search.timeout = true;
+                    return 0;
+                }
+            }
+            return total / AI_CHANCE_SAMPLES;
+        }
+
+        /*!
+         * \brief Returns the value of a move, which is the value of the turn when the targeted opponent chooses its worst answer.
+         */
+        double answer(BattleState const &state, int move, int depth, Search &search) {
+            BattleChoice choices[BATTLE_MAX_COMBATANTS];
+            defaultChoices(state, choices);
+            int other = BattleEngine::getTarget(state, search.side, -1);
+            choices[search.side] = {Elements::TurnType::MOVE, move, other};
+            int moves[4];
+            int count = BattleEngine::listMoves(state.combatants[other], moves);
+            if(count == 0) {
+                //The opponent can't move at all
+                choices[other] = {Elements::TurnType::CHANGE, 0, search.side};
+                return resolve(state, choices, depth, search);
+            }
+            double worst = std::numeric_limits<double>::max();
+            for(int i = 0; i < count && !search.timeout; i++) {
+                choices[other] = {Elements::TurnType::MOVE, moves[i], search.side};
+                worst = std::min(worst, resolve(state, choices, depth, search));
+            }
+            return worst;
+        }
+
+        /*!
+         * \brief Returns the value of the best move of the searching side.
+         */
+        double decide(BattleState const &state, int depth, Search &search) {
+            int moves[4];
+            int count = BattleEngine::listMoves(state.combatants[search.side], moves);
+            if(count == 0 || state.combatants[search.side].hp <= 0) {
+                return evaluate(state, search.side);
+            }
+            double best = std::numeric_limits<double>::lowest();
+            for(int i = 0; i < count && !search.timeout; i++) {
+                best = std::max(best, answer(state, moves[i], depth, search));
+            }
+            return best;
+        }
+    } // namespace
+
+    BattleAI::BattleAI(int level, int budget)
+      : budget(budget) {
+        setLevel(level);
+    }
+
+    void BattleAI::setLevel(int level) {
+        maxDepth = std::max(1, level + 1);
+    }
+
+    void BattleAI::think(BattleState const &state, int side) {
+        unsigned int seed = Utils::Misc::getRNGEngine()();
+        pending = std::async(std::launch::async, [this, state, side, seed]() { return search(state, side, seed); });
+    }
+
+    BattleChoice BattleAI::getChoice(BattleState const &state, int side) {
+        if(pending.valid()) {
+            return pending.get();
+        }
+        return search(state, side, Utils::Misc::getRNGEngine()());
+    }
+
+    BattleChoice BattleAI::search(BattleState const &state, int side, unsigned int seed) const {
+        Search search{side, std::chrono::steady_clock::now() + std::chrono::milliseconds(budget), std::minstd_rand(seed), BattleLog(), false};
+        search.log.reserve(64);
+
+        int moves[4];
+        int count = BattleEngine::listMoves(state.combatants[side], moves);
+        BattleChoice choice = {Elements::TurnType::MOVE, count > 0 ? moves[0] : 0, BattleEngine::getTarget(state, side, -1)};
+        if(count <= 1) {
+            return choice;
+        }
+        //Iterative deepening : the choice of a depth is kept only if all the moves have been evaluated.
+        for(int depth = 1; depth <= maxDepth; depth++) {
+            double bestValue = std::numeric_limits<double>::lowest();
+            int bestMove = moves[0];
+            for(int i = 0; i < count && !search.timeout; i++) {
+                double value = answer(state, moves[i], depth, search);
+                if(value > bestValue) {
+                    bestValue = value;
+                    bestMove = moves[i];
+                }
+            }
+            if(search.timeout) {
+                break;
+            }
+            choice.move = bestMove;
+        }
+        return choice;
+    }
+
+} // namespace OpMon
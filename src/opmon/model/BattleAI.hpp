@@ -0,0 +1,77 @@
+/*!
+ * \file BattleAI.hpp
+ * \author Cyrielle
+ * \copyright GNU GPL v3.0
+ */
+#pragma once
+
+#include <future>
+
+#include "BattleEngine.hpp"
+
+/*!
+ * \brief The default level of the trainers' AI.
+ */
+#define AI_DEFAULT_LEVEL 1
+/*!
+ * \brief The default time given to the AI to choose an action, in milliseconds.
+ */
+#define AI_DEFAULT_BUDGET 100
+
+namespace OpMon {
+
+    /*!
+     * \brief Chooses the actions of a combatant of a battle.
+     * \details The choice is searched with an expectimax over the battle states : the AI takes the move with the best expected outcome, assuming its target
+     * answers with the move which is the worst for the AI. The other combatants are assumed to use their first move. The random parts of a turn (accuracy, critical hits, damage rolls, status) are the chance nodes : each
+     * pair of moves is resolved several times with different seeds and the results are averaged. The search never reads the seed of the battle, so it can't
+     * predict the real random numbers.
+     *
+     * The search deepens one turn at a time until the depth given by the level is reached or the time budget runs out, the choice of the last complete depth being kept.
+     */
+    class BattleAI {
+      public:
+        /*!
+         * \param level The level of intelligence. The AI looks `level + 1` turns ahead.
+         * \param budget The maximum time of a search, in milliseconds.
+         */
+        BattleAI(int level = AI_DEFAULT_LEVEL, int budget = AI_DEFAULT_BUDGET);
+
+        void setLevel(int level);
+        void setBudget(int budget) {
+            this->budget = budget;
+        }
+
+        /*!
+         * \brief Starts searching the choice of a combatant in a worker thread.
+         * \details The state is copied, so it can be changed while the AI thinks.
+         */
+        void think(BattleState const &state, int side);
+        /*!
+         * \brief Returns `true` if a search has been started and its choice has not been taken yet.
+         */
+        bool isThinking() const {
+            return pending.valid();
+        }
+        /*!
+         * \brief Returns the choice found by the last call to think(), waiting for the end of the search if needed.
+         * \details If think() hasn't been called, the choice is searched in the calling thread.
+         */
+        BattleChoice getChoice(BattleState const &state, int side);
+
+        /*!
+         * \brief Searches the choice of a combatant in the calling thread.
+         * \param seed The seed of the random numbers used by the chance nodes.
+         */
+        BattleChoice search(BattleState const &state, int side, unsigned int seed) const;
+
+      private:
+        /*!
+         * \brief The number of turns looked ahead.
+         */
+        int maxDepth;
+        int budget;
+        std::future<BattleChoice> pending;
+    };
+
+} // namespace OpMon
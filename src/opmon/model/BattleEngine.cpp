@@ -0,0 +1,307 @@
+/*
+BattleEngine.cpp
+Author : Cyrielle
+File under GNU GPL v3.0 license
+*/
+#include "BattleEngine.hpp"
+
+#include <algorithm>
+#include <vector>
+
+#include "Move.hpp"
+#include "OpMon.hpp"
+
+namespace OpMon {
+    namespace BattleEngine {
+
+        namespace {
+            /*!
+             * \brief Checks if an OpMon can move, according to its status.
+             */
+            bool canMove(BattleState &state, int side, BattleLog &log) {
+                Combatant &opmon = state.combatants[side];
+                bool canMove = true;
+                //Checks if frozen
+                if(opmon.status == Status::FROZEN) {
+                    //The OpMon have one chance out of 5 to be able to move again.
+                    if(roll(state, 5) == 2) {
+                        log.push_back({BattleLogType::FROZEN_OUT, (std::uint8_t)side, 0, 0});
+                        opmon.status = Status::NOTHING;
+                    } else {
+                        log.push_back({BattleLogType::FROZEN, (std::uint8_t)side, 0, 0});
+                        canMove = false;
+                    }
+                    //Checks if sleeping
+                } else if(opmon.status == Status::SLEEPING) {
+                    //Checks the sleep counter.
+                    if(opmon.sleepingCD <= 0) {
+                        log.push_back({BattleLogType::SLEEP_OUT, (std::uint8_t)side, 0, 0});
+                        opmon.status = Status::NOTHING;
+                    } else {
+                        log.push_back({BattleLogType::SLEEP, (std::uint8_t)side, 0, 0});
+                        canMove = false;
+                        opmon.sleepingCD--;
+                    }
+                    //Checks if paralysed
+                } else if(opmon.status == Status::PARALYSED) {
+                    //The opmon have one chance out of four to can't move when paralysed
+                    if(roll(state, 4) == 2) {
+                        log.push_back({BattleLogType::PARALYSED_FAIL, (std::uint8_t)side, 0, 0});
+                        canMove = false;
+                    } else {
+                        log.push_back({BattleLogType::PARALYSED_SUCCESS, (std::uint8_t)side, 0, 0});
+                    }
+                }
+                //Checks if confused
+                if(opmon.confused) {
+                    //Checks the confused counter
+                    if(opmon.confusedCD <= 0) {
+                        opmon.confused = false;
+                        log.push_back({BattleLogType::CONFUSED_OUT, (std::uint8_t)side, 0, 0});
+                    } else {
+                        opmon.confusedCD--;
+                        //The OpMon have one chance out of two of hurting itself.
+                        if(roll(state, 2) == 1) {
+                            int hpLost = opmon.maxHp / 8;
+                            log.push_back({BattleLogType::CONFUSED_FAIL, (std::uint8_t)side, 0, 0});
+                            log.push_back({BattleLogType::DAMAGE, (std::uint8_t)side, (std::int16_t)hpLost, 0});
+                            opmon.hp = std::max(0, opmon.hp - hpLost);
+                        } else {
+                            log.push_back({BattleLogType::CONFUSED_SUCCESS, (std::uint8_t)side, 0, 0});
+                        }
+                    }
+                }
+                //Checks if afraid
+                if(opmon.afraid) {
+                    log.push_back({BattleLogType::AFRAID, (std::uint8_t)side, 0, 0});
+                    opmon.afraid = false;
+                    canMove = false;
+                }
+                return canMove;
+            }
+
+            /*!
+             * \brief Makes an OpMon use one of its moves on another one.
+             */
+            void useMove(BattleState &state, int user, int slot, int target, BattleLog &log) {
+                Combatant &attacker = state.combatants[user];
+                Combatant &defender = state.combatants[target];
+                Move const &move = *attacker.moves[slot];
+                Moves::EffectList const &effects = move.getEffects();
+                Moves::EffectContext context{state, user, target, log, 1, 0};
+
+                attacker.pp[slot]--;
+                log.push_back({BattleLogType::MOVE, (std::uint8_t)user, (std::int16_t)slot, 0});
+                //Move fail
+                if(roll(state, 100) > move.getAccuracy() * (getStat(attacker, Stats::ACC) / getStat(defender, Stats::EVA)) && !move.isNeverFailing()) {
+                    log.push_back({BattleLogType::MISS, (std::uint8_t)user, 0, 0});
+                    effects.run(Moves::EffectPhase::FAIL, context);
+                    return;
+                }
+                if(!effects.run(Moves::EffectPhase::PRE, context)) {
+                    return;
+                }
+                //If type unefficiency
+                float effectiveness = ArrayTypes::calcEffectiveness(move.getType(), defender.types[0], defender.types[1]);
+                if(effectiveness == 0 && (!move.isNeverFailing() || !move.isStatus())) {
+                    log.push_back({BattleLogType::NO_EFFECT, (std::uint8_t)user, 0, 0});
+                    effects.run(Moves::EffectPhase::FAIL, context);
+                    return;
+                }
+
+                //Animation time
+                for(Elements::TurnActionType tat : move.getAnimationOrder()) {
+                    log.push_back({BattleLogType::ANIMATION, (std::uint8_t)user, (std::int16_t)tat, 0});
+                }
+
+                if(!move.isStatus()) { //Check if it isn't a status move to calculate the hp lost
+                    int hit = 0;
+                    for(; hit < context.hits && defender.hp > 0; hit++) {
+                        bool critical = roll(state, move.getCriticalRate()) == 1;
+                        int hpLost = calcDamage(attacker, defender, move, critical, roll(state, 16));
+                        context.damage += std::min(hpLost, defender.hp);
+                        defender.hp = std::max(0, defender.hp - hpLost);
+                        log.push_back({BattleLogType::DAMAGE, (std::uint8_t)target, (std::int16_t)hpLost, 0});
+                    }
+                    if(hit > 1) {
+                        log.push_back({BattleLogType::HITS, (std::uint8_t)user, (std::int16_t)hit, 0});
+                    }
+                    if(effectiveness != 1) {
+                        log.push_back({BattleLogType::EFFECTIVENESS, (std::uint8_t)user, (std::int16_t)(effectiveness * 4), 0});
+                    }
+                }
+                effects.run(Moves::EffectPhase::POST, context);
+            }
+        } // namespace
+
+        Combatant makeCombatant(OpMon &opmon, int team) {
+            Combatant combatant{};
+            combatant.team = team;
+            combatant.hp = opmon.getHP();
+            combatant.maxHp = opmon.getStatHP();
+            combatant.level = opmon.getLevel();
+            for(Stats stat : {Stats::ATK, Stats::DEF, Stats::ATKSPE, Stats::DEFSPE, Stats::SPE, Stats::HP}) {
+                combatant.stats[(int)stat] = opmon.getUnmodifiedStat(stat);
+            }
+            //The accuracy and the evasion are reset at the beginning of each battle
+            combatant.stats[(int)Stats::ACC] = 100;
+            combatant.stats[(int)Stats::EVA] = 100;
+            combatant.types[0] = opmon.getType1();
+            combatant.types[1] = opmon.getType2();
+            combatant.status = opmon.getStatus();
+            combatant.confused = opmon.confused;
+            combatant.afraid = opmon.afraid;
+            combatant.confusedCD = opmon.getConfusedCD();
+            combatant.sleepingCD = opmon.getSleepingCD();
+            std::vector<Move *> moves = opmon.getMoves();
+            for(std::size_t i = 0; i < 4 && i < moves.size(); i++) {
+                combatant.moves[i] = moves[i];
+                combatant.pp[i] = moves[i] ? moves[i]->getPP() : 0;
+            }
+            return combatant;
+        }
+
+        void applyCombatant(Combatant const &combatant, OpMon &opmon) {
+            if(combatant.hp < opmon.getHP()) {
+                opmon.attacked(opmon.getHP() - combatant.hp);
+            } else {
+                opmon.heal(combatant.hp - opmon.getHP());
+            }
+            if(combatant.status != opmon.getStatus()) {
+                opmon.setStatus(combatant.status);
+            }
+            opmon.confused = combatant.confused;
+            opmon.afraid = combatant.afraid;
+            while(opmon.getConfusedCD() > combatant.confusedCD) {
+                opmon.passCD(false);
+            }
+            while(opmon.getSleepingCD() > combatant.sleepingCD) {
+                opmon.passCD(true);
+            }
+            std::vector<Move *> moves = opmon.getMoves();
+            for(std::size_t i = 0; i < 4 && i < moves.size(); i++) {
+                if(moves[i] != nullptr) {
+                    moves[i]->setPP(combatant.pp[i]);
+                }
+            }
+        }
+
+        int roll(BattleState &state, int limit) {
+            //SplitMix64
+            std::uint64_t z = (state.random += 0x9E3779B97F4A7C15ull);
+            z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+            z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+            z ^= z >> 31;
+            return limit <= 0 ? 0 : (int)(z % (std::uint64_t)limit);
+        }
+
+        int getStat(Combatant const &combatant, Stats stat) {
+            return StatStages::apply(combatant.stats[(int)stat], stat, combatant.stages[(int)stat]);
+        }
+
+        int changeStage(Combatant &combatant, Stats stat, int coef) {
+            int old = combatant.stages[(int)stat];
+            combatant.stages[(int)stat] = (std::int8_t)StatStages::clamp(old + coef);
+            return combatant.stages[(int)stat] - old;
+        }
+
+        int calcDamage(Combatant const &attacker, Combatant const &defender, Move const &move, bool critical, int roll) {
+            int attack = getStat(attacker, move.isSpecial() ? Stats::ATKSPE : Stats::ATK);
+            int defense = getStat(defender, move.isSpecial() ? Stats::DEFSPE : Stats::DEF);
+            bool stab = move.getType() == attacker.types[0] || move.getType() == attacker.types[1];
+            int effectiveness = ArrayTypes::calcEffectiveness(move.getType(), defender.types[0], defender.types[1]) * 4;
+            return rollDamage(baseDamage(attacker.level, attack, defense, move.getPower(), stab, effectiveness, critical), roll);
+        }
+
+        void getOrder(BattleState const &state, BattleChoice const choices[], int order[]) {
+            //Returns `true` if `one` acts after `two`, so the top of the heap is the combatant acting first.
+            auto after = [&](int one, int two) {
+                bool moveOne = choices[one].type == Elements::TurnType::MOVE;
+                bool moveTwo = choices[two].type == Elements::TurnType::MOVE;
+                //Item use or switching always comes before the moves.
+                if(moveOne != moveTwo) {
+                    return moveOne;
+                }
+                if(moveOne) {
+                    int priorityOne = state.combatants[one].moves[choices[one].move]->getPriority();
+                    int priorityTwo = state.combatants[two].moves[choices[two].move]->getPriority();
+                    if(priorityOne != priorityTwo) {
+                        return priorityOne < priorityTwo;
+                    }
+                    int speedOne = getStat(state.combatants[one], Stats::SPE);
+                    int speedTwo = getStat(state.combatants[two], Stats::SPE);
+                    if(speedOne != speedTwo) {
+                        return speedOne < speedTwo;
+                    }
+                }
+                return one < two;
+            };
+            int heap[BATTLE_MAX_COMBATANTS];
+            for(int i = 0; i < state.count; i++) {
+                heap[i] = i;
+            }
+            std::make_heap(heap, heap + state.count, after);
+            for(int i = state.count; i > 0; i--) {
+                std::pop_heap(heap, heap + i, after);
+                order[state.count - i] = heap[i - 1];
+            }
+        }
+
+        int listMoves(Combatant const &combatant, int moves[4]) {
+            int count = 0;
+            for(int i = 0; i < 4; i++) {
+                if(combatant.moves[i] != nullptr && combatant.pp[i] > 0) {
+                    moves[count++] = i;
+                }
+            }
+            for(int i = 0; i < 4 && count == 0; i++) {
+                if(combatant.moves[i] != nullptr) {
+                    moves[count++] = i;
+                }
+            }
+            return count;
+        }
+
+        int getTarget(BattleState const &state, int user, int target) {
+            int team = state.combatants[user].team;
+            if(target >= 0 && target < state.count && state.combatants[target].team != team && state.combatants[target].hp > 0) {
+                return target;
+            }
+            for(int i = 0; i < state.count; i++) {
+                if(state.combatants[i].team != team && state.combatants[i].hp > 0) {
+                    return i;
+                }
+            }
+            return -1;
+        }
+
+        bool resolveTurn(BattleState &state, BattleChoice const choices[], BattleLog &log) {
+            log.clear();
+            int order[BATTLE_MAX_COMBATANTS];
+            getOrder(state, choices, order);
+            //If nobody moves, nothing is shown.
+            bool moves = std::any_of(choices, choices + state.count, [](BattleChoice const &choice) { return choice.type == Elements::TurnType::MOVE; });
+            for(int i = 0; i < state.count && moves; i++) {
+                int user = order[i];
+                if(i > 0) {
+                    log.push_back({BattleLogType::NEXT, 0, 0, 0});
+                }
+                if(choices[user].type != Elements::TurnType::MOVE || isOver(state) || state.combatants[user].hp <= 0) {
+                    continue;
+                }
+                if(canMove(state, user, log)) {
+                    int target = getTarget(state, user, choices[user].target);
+                    if(target >= 0) {
+                        useMove(state, user, choices[user].move, target, log);
+                    }
+                }
+            }
+            if(isOver(state)) {
+                log.push_back({BattleLogType::END, (std::uint8_t)getWinner(state), 0, 0});
+                return true;
+            }
+            return false;
+        }
+
+    } // namespace BattleEngine
+} // namespace OpMon
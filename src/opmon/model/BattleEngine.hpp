@@ -0,0 +1,218 @@
+/*!
+ * \file BattleEngine.hpp
+ * \author Cyrielle
+ * \copyright GNU GPL v3.0
+ */
+#pragma once
+
+#include <cstdint>
+#include <type_traits>
+
+#include "BattleLog.hpp"
+#include "Enums.hpp"
+#include "StatStages.hpp"
+#include "../view/elements/Turn.hpp"
+
+/*!
+ * \brief The maximum number of OpMons fighting at the same time in a battle.
+ */
+#define BATTLE_MAX_COMBATANTS 6
+
+namespace OpMon {
+
+    class Move;
+    class OpMon;
+
+    /*!
+     * \brief The state of an OpMon during a battle.
+     * \details The stats are stored without their modifications, which are kept as stages (see BattleEngine::getStat).
+     * The moves are only read during the battle : everything changing during a turn, like the PP, is stored here.
+     */
+    struct Combatant {
+        /*!
+         * \brief The team of the OpMon, 0 being the player's and 1 the opponent's.
+         */
+        int team;
+        int hp;
+        int maxHp;
+        int level;
+        /*!
+         * \brief The stats, indexed by Stats.
+         */
+        int stats[9];
+        /*!
+         * \brief The modification stages of the stats, from -STAT_MAX_STAGE to STAT_MAX_STAGE, indexed by Stats.
+         */
+        std::int8_t stages[9];
+        Type types[2];
+        Status status;
+        bool confused;
+        bool afraid;
+        int confusedCD;
+        int sleepingCD;
+        Move const *moves[4];
+        int pp[4];
+    };
+
+    /*!
+     * \brief The state of a battle between two teams.
+     * \details Everything changing during a battle is stored here, and nowhere else until the end of the battle (see BattleEngine::applyCombatant).
+     * The state is trivially copyable, so a copy is only a memcpy : the search of the AI copies it at each node.
+     */
+    struct BattleState {
+        /*!
+         * \brief The fighting OpMons of the two teams. In a battle between two OpMons, 0 is the player's and 1 the opponent's.
+         */
+        Combatant combatants[BATTLE_MAX_COMBATANTS];
+        /*!
+         * \brief The number of fighting OpMons.
+         */
+        int count;
+        /*!
+         * \brief The state of the random number generator of the battle.
+         */
+        std::uint64_t random;
+    };
+
+    static_assert(std::is_trivially_copyable_v<BattleState>, "The battle state has to be copied with a memcpy.");
+
+    /*!
+     * \brief The action chosen by a combatant for a turn.
+     */
+    struct BattleChoice {
+        Elements::TurnType type;
+        /*!
+         * \brief The slot of the move used, if `type` is TurnType::MOVE.
+         */
+        int move;
+        /*!
+         * \brief The index of the combatant targeted by the move. If it is K.O. or in the same team when the move is used, the move targets another opponent (see BattleEngine::getTarget).
+         */
+        int target;
+    };
+
+    /*!
+     * \brief The battle rules, working only on BattleState objects.
+     * \details Nothing here depends on the view : the results of a turn are written in a BattleLog, which is then shown by the controller of the battle screen.
+     */
+    namespace BattleEngine {
+
+        /*!
+         * \brief Creates the battle state of an OpMon.
+         * \param team The team of the OpMon, 0 for the player's and 1 for the opponent's.
+         */
+        Combatant makeCombatant(OpMon &opmon, int team);
+        /*!
+         * \brief Applies the consequences of the battle (HP, PP, status) on an OpMon. Called once the battle is over.
+         * \details The stat stages are not applied, so the stats of the OpMon are the same as before the battle.
+         */
+        void applyCombatant(Combatant const &combatant, OpMon &opmon);
+
+        /*!
+         * \brief Returns a random number in [0, limit - 1], using the generator of the battle.
+         */
+        int roll(BattleState &state, int limit);
+
+        /*!
+         * \brief Returns a stat with its modification stage applied, with the multipliers of StatStages.
+         */
+        int getStat(Combatant const &combatant, Stats stat);
+        /*!
+         * \brief Changes the modification stage of a stat.
+         * \returns The change really done, the stages being limited to [-STAT_MAX_STAGE, STAT_MAX_STAGE].
+         */
+        int changeStage(Combatant &combatant, Stats stat, int coef);
+
+        /*!
+         * \brief Calculates the damages of a move.
+         * \param critical If the hit is critical.
+         * \param roll The random part of the damages, in [0, 15].
+         */
+        int calcDamage(Combatant const &attacker, Combatant const &defender, Move const &move, bool critical, int roll);
+
+        /*!
+         * \brief Applies the bonus of a critical hit, which is the last step of baseDamage.
+         */
+        inline int criticalDamage(int damage) {
+            return (3 * damage + 1) / 2;
+        }
+        /*!
+         * \brief Calculates the damages of a move before the random part.
+         * \details Used by calcDamage and by DamageBatch::estimate, so they always give the same results.
+         * The damages are never negative, so the roundings are done with integers, without branches : `round(x * 1.5)` is `(3 * x + 1) / 2`.
+         * \param stab If the move has one of the types of the attacker.
+         * \param effectiveness The effectiveness of the move multiplied by 4 (ArrayTypes::calcEffectiveness always returns a multiple of 0.25).
+         */
+        inline int baseDamage(int level, int attack, int defense, int power, bool stab, int effectiveness, bool critical) {
+            int hpLost = (((level * 0.4 + 2) * attack * power) / (defense * 50) + 2);
+            hpLost = stab ? (3 * hpLost + 1) / 2 : hpLost;
+            hpLost = (hpLost * effectiveness + 2) / 4;
+            return critical ? criticalDamage(hpLost) : hpLost;
+        }
+        /*!
+         * \brief Applies the random part of the damages.
+         * \param roll The random part, in [0, 15].
+         */
+        inline int rollDamage(int damage, int roll) {
+            return damage * (roll + 85) / 100;
+        }
+
+        /*!
+         * \brief Sorts the combatants in the order in which they act in a turn.
+         * \details The actions which aren't moves come first, then the moves by priority, then by speed. If two combatants are tied, the one with the biggest index acts first.
+         * The actions are ordered with a binary heap, so the cost is O(N log N) for N combatants.
+         * \param choices The choices of all the combatants.
+         * \param order Filled with the indexes of the combatants, in the order in which they act. Its size has to be at least `state.count`.
+         */
+        void getOrder(BattleState const &state, BattleChoice const choices[], int order[]);
+
+        /*!
+         * \brief Lists the slots of the moves a combatant can use.
+         * \details If all the moves are out of PP, they are all listed, as the combatant has to do something.
+         * \returns The number of moves listed.
+         */
+        int listMoves(Combatant const &combatant, int moves[4]);
+
+        /*!
+         * \brief Returns the combatant really targeted by a move.
+         * \returns `target` if it is an opponent of `user` which is not K.O., the first opponent which is not K.O. otherwise, or -1 if there isn't any.
+         */
+        int getTarget(BattleState const &state, int user, int target);
+
+        /*!
+         * \brief Resolves a turn.
+         * \param choices The choices of all the combatants, indexed like BattleState::combatants.
+         * \param log Filled with what happened during the turn.
+         * \returns `true` if the battle is over.
+         */
+        bool resolveTurn(BattleState &state, BattleChoice const choices[], BattleLog &log);
+
+        /*!
+         * \brief Returns `true` if all the OpMons of a team are K.O.
+         */
+        inline bool isDefeated(BattleState const &state, int team) {
+            for(int i = 0; i < state.count; i++) {
+                if(state.combatants[i].team == team && state.combatants[i].hp > 0) {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        /*!
+         * \brief Returns `true` if all the OpMons of one of the teams are K.O.
+         */
+        inline bool isOver(BattleState const &state) {
+            return isDefeated(state, 0) || isDefeated(state, 1);
+        }
+
+        /*!
+         * \brief Returns the team which won the battle, which has to be over. If both teams are K.O., the player wins.
+         */
+        inline int getWinner(BattleState const &state) {
+            return isDefeated(state, 1) ? 0 : 1;
+        }
+
+    } // namespace BattleEngine
+
+} // namespace OpMon
@@ -0,0 +1,60 @@
+/*!
+ * \file BattleLog.hpp
+ * \author Cyrielle
+ * \copyright GNU GPL v3.0
+ */
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+namespace OpMon {
+
+    /*!
+     * \brief Enumerates what can happen during a turn.
+     * \details In the comments, `side` and `value` are the fields of the BattleLogEntry.
+     */
+    enum class BattleLogType : std::uint8_t {
+        MOVE, /*!< The OpMon of `side` uses the move in the slot `value`.*/
+        MISS, /*!< The move of the OpMon of `side` misses.*/
+        NO_EFFECT, /*!< The move of the OpMon of `side` has no effect on its target.*/
+        ANIMATION, /*!< The move of the OpMon of `side` plays an animation, `value` being an Elements::TurnActionType.*/
+        DAMAGE, /*!< The OpMon of `side` loses `value` HP.*/
+        EFFECTIVENESS, /*!< The move of the OpMon of `side` has an effectiveness of `value` / 4.*/
+        STAT_CHANGE, /*!< The stat `value` of the OpMon of `side` is changed, `extra` being the coefficient of the change.*/
+        FROZEN_OUT, /*!< The OpMon of `side` is not frozen anymore.*/
+        FROZEN, /*!< The OpMon of `side` can't move because it is frozen.*/
+        SLEEP_OUT, /*!< The OpMon of `side` wakes up.*/
+        SLEEP, /*!< The OpMon of `side` can't move because it is sleeping.*/
+        PARALYSED_FAIL, /*!< The OpMon of `side` can't move because it is paralysed.*/
+        PARALYSED_SUCCESS, /*!< The OpMon of `side` moves despite its paralysis.*/
+        CONFUSED_OUT, /*!< The OpMon of `side` is not confused anymore.*/
+        CONFUSED_FAIL, /*!< The OpMon of `side` hurts itself in its confusion.*/
+        CONFUSED_SUCCESS, /*!< The OpMon of `side` moves despite its confusion.*/
+        AFRAID, /*!< The OpMon of `side` can't move because it is afraid.*/
+        STATUS, /*!< The OpMon of `side` gets the Status `value`.*/
+        CONFUSED, /*!< The OpMon of `side` becomes confused.*/
+        HEAL, /*!< The OpMon of `side` gets `value` HP back.*/
+        HITS, /*!< The move of the OpMon of `side` hit `value` times.*/
+        NEXT, /*!< This is now the turn of the next OpMon.*/
+        END /*!< The battle is over, `side` being the team which won.*/
+    };
+
+    /*!
+     * \brief One thing happening during a turn.
+     * \details `side` is the index of the OpMon in BattleState::combatants. In a battle between two OpMons, 0 is the player's and 1 the opponent's.
+     */
+    struct BattleLogEntry {
+        BattleLogType type;
+        std::uint8_t side;
+        std::int16_t value;
+        std::int16_t extra;
+    };
+
+    /*!
+     * \brief The log of a turn, filled by BattleEngine::resolveTurn and read by the controller showing the battle.
+     * \details The log is meant to be cleared and reused for each turn, so it doesn't allocate memory once it is large enough.
+     */
+    using BattleLog = std::vector<BattleLogEntry>;
+
+} // namespace OpMon
@@ -0,0 +1,318 @@
+/*
+BattleReplay.cpp
+Author : Cyrielle
+File under GNU GPL v3.0 license
+*/
+#include "BattleReplay.hpp"
+
+#include <cstdint>
+#include <fstream>
+#include <memory>
+#include <type_traits>
+
+#include "../../utils/StringKeys.hpp"
+#include "../../utils/exceptions.hpp"
+#include "Move.hpp"
+#include "OpMon.hpp"
+#include "Species.hpp"
+
+/*!
+ * \brief The bytes starting a replay file.
+ */
+#define REPLAY_MAGIC "OPRP"
+
+namespace OpMon {
+
+    namespace {
+        /*!
+         * \brief Writes an integer in little endian.
+         */
+        template <typename T>
+        void write(std::ostream &stream, T value) {
+            static_assert(std::is_integral_v<T>, "Only integers can be written.");
+            auto bits = (std::make_unsigned_t<T>)value;
+            for(std::size_t i = 0; i < sizeof(T); i++) {
+                stream.put((char)((bits >> (8 * i)) & 0xFF));
+            }
+        }
+
+        /*!
+         * \brief Reads an integer written by write().
+         */
+        template <typename T>
+        T read(std::istream &stream) {
+            static_assert(std::is_integral_v<T>, "Only integers can be read.");
+            std::make_unsigned_t<T> bits = 0;
+            for(std::size_t i = 0; i < sizeof(T); i++) {
+                bits |= (std::make_unsigned_t<T>)(std::uint8_t)stream.get() << (8 * i);
+            }
+            return (T)bits;
+        }
+
+        void writeString(std::ostream &stream, std::string const &str) {
+            write<std::uint16_t>(stream, str.size());
+            stream.write(str.data(), str.size());
+        }
+
+        std::string readString(std::istream &stream) {
+            std::string str(read<std::uint16_t>(stream), '\0');
+            stream.read(str.data(), str.size());
+            return str;
+        }
+
+        void writeCombatant(std::ostream &stream, Combatant const &combatant) {
+            write<std::uint8_t>(stream, combatant.team);
+            write<std::int32_t>(stream, combatant.hp);
+            write<std::int32_t>(stream, combatant.maxHp);
+            write<std::int32_t>(stream, combatant.level);
+            for(int i = 0; i < 9; i++) {
+                write<std::int32_t>(stream, combatant.stats[i]);
+                write<std::int8_t>(stream, combatant.stages[i]);
+            }
+            write<std::int8_t>(stream, (int)combatant.types[0]);
+            write<std::int8_t>(stream, (int)combatant.types[1]);
+            write<std::uint8_t>(stream, (int)combatant.status);
+            write<std::uint8_t>(stream, combatant.confused);
+            write<std::uint8_t>(stream, combatant.afraid);
+            write<std::int32_t>(stream, combatant.confusedCD);
+            write<std::int32_t>(stream, combatant.sleepingCD);
+            for(int i = 0; i < 4; i++) {
+                write<std::int32_t>(stream, combatant.pp[i]);
+            }
+        }
+
+        Combatant readCombatant(std::istream &stream) {
+            Combatant combatant = {};
+            combatant.team = read<std::uint8_t>(stream);
+            combatant.hp = read<std::int32_t>(stream);
+            combatant.maxHp = read<std::int32_t>(stream);
+            combatant.level = read<std::int32_t>(stream);
+            for(int i = 0; i < 9; i++) {
+                combatant.stats[i] = read<std::int32_t>(stream);
+                combatant.stages[i] = read<std::int8_t>(stream);
+            }
+            combatant.types[0] = (Type)read<std::int8_t>(stream);
+            combatant.types[1] = (Type)read<std::int8_t>(stream);
+            combatant.status = (Status)read<std::uint8_t>(stream);
+            combatant.confused = read<std::uint8_t>(stream) != 0;
+            combatant.afraid = read<std::uint8_t>(stream) != 0;
+            combatant.confusedCD = read<std::int32_t>(stream);
+            combatant.sleepingCD = read<std::int32_t>(stream);
+            for(int i = 0; i < 4; i++) {
+                combatant.pp[i] = read<std::int32_t>(stream);
+            }
+            return combatant;
+        }
+
+        /*!
+         * \brief Throws an exception if a value read from a replay is out of its range.
+         */
+        void check(int value, int min, int max, std::string const &name) {
+            if(value < min || value > max) {
+                throw Utils::UnexpectedValueException(name + " " + std::to_string(value), name + " in [" + std::to_string(min) + ", " + std::to_string(max) + "]", false);
+            }
+        }
+
+        /*!
+         * \brief Checks the values of a combatant read from a replay, which are used as indexes by the engine and the view.
+         */
+        void checkCombatant(Combatant const &combatant, int count) {
+            check(combatant.team, 0, count - 1, "team");
+            check(combatant.maxHp, 1, INT32_MAX, "maximum HP");
+            check(combatant.hp, 0, combatant.maxHp, "HP");
+            for(int i = 1; i < 9; i++) {
+                //The stats are used as divisors, and stats[0] is Stats::NOTHING
+                check(combatant.stats[i], 1, INT32_MAX, "stat");
+                check(combatant.stages[i], -STAT_MAX_STAGE, STAT_MAX_STAGE, "stage");
+            }
+            for(Type type : combatant.types) {
+                check((int)type, (int)Type::NOTHING, (int)Type::SKY, "type");
+            }
+            check((int)combatant.status, (int)Status::BURNING, (int)Status::NOTHING, "status");
+            for(int pp : combatant.pp) {
+                check(pp, 0, INT32_MAX, "PP");
+            }
+        }
+
+        /*!
+         * \brief Checks a choice read from a replay.
+         * \param opmon The OpMon making the choice.
+         */
+        void checkChoice(BattleChoice const &choice, ReplayOpMon const &opmon, int count) {
+            check((int)choice.type, (int)Elements::TurnType::MOVE, (int)Elements::TurnType::CHANGE, "choice");
+            check(choice.move, 0, 3, "move slot");
+            check(choice.target, 0, count - 1, "target");
+            if(choice.type == Elements::TurnType::MOVE && opmon.moves[choice.move].empty()) {
+                throw Utils::UnexpectedValueException("empty move slot " + std::to_string(choice.move), "a slot with a move", false);
+            }
+        }
+    } // namespace
+
+    void BattleReplay::start(BattleState const &state, OpMon *const opmons[]) {
+        this->opmons.resize(state.count);
+        for(int i = 0; i < state.count; i++) {
+            ReplayOpMon &opmon = this->opmons[i];
+            opmon.species = opmons[i]->getSpecies().getOpdexNumber();
+            opmon.nickname = Utils::StringKeys::sfStringtoStdString(opmons[i]->getNickname());
+            std::vector<Move *> moves = opmons[i]->getMoves();
+            for(std::size_t slot = 0; slot < 4; slot++) {
+                opmon.moves[slot] = (slot < moves.size() && moves[slot] != nullptr) ? moves[slot]->getId() : "";
+            }
+            opmon.start = state.combatants[i];
+        }
+        seed = state.random;
+        choices.clear();
+        over = false;
+        finalHp.clear();
+    }
+
+    void BattleReplay::addTurn(BattleChoice const choices[]) {
+        this->choices.insert(this->choices.end(), choices, choices + opmons.size());
+    }
+
+    void BattleReplay::end(BattleState const &state) {
+        over = true;
+        finalHp.clear();
+        for(int i = 0; i < state.count; i++) {
+            finalHp.push_back(state.combatants[i].hp);
+        }
+    }
+
+    BattleState BattleReplay::makeState(std::vector<Move *> const moves[]) const {
+        BattleState state = {};
+        state.count = opmons.size();
+        for(int index = 0; index < state.count; index++) {
+            state.combatants[index] = opmons[index].start;
+            for(std::size_t i = 0; i < 4; i++) {
+                state.combatants[index].moves[i] = (i < moves[index].size()) ? moves[index][i] : nullptr;
+            }
+        }
+        state.random = seed;
+        return state;
+    }
+
+    BattleState BattleReplay::getStartState(OpMon *const opmons[]) const {
+        std::vector<Move *> moves[BATTLE_MAX_COMBATANTS];
+        for(int i = 0; i < getCount(); i++) {
+            moves[i] = opmons[i]->getMoves();
+        }
+        return makeState(moves);
+    }
+
+    bool BattleReplay::verify() const {
+        std::vector<std::unique_ptr<Move>> owned;
+        std::vector<Move *> moves[BATTLE_MAX_COMBATANTS];
+        for(int side = 0; side < getCount(); side++) {
+            for(std::string const &id : opmons[side].moves) {
+                Move *move = id.empty() ? nullptr : Move::newMove(id);
+                if(!id.empty() && move == nullptr) {
+                    return false;
+                }
+                owned.emplace_back(move);
+                moves[side].push_back(move);
+            }
+        }
+
+        BattleState state = makeState(moves);
+        BattleLog log;
+        bool ended = false;
+        for(std::size_t turn = 0; turn < getTurnCount(); turn++) {
+            if(ended) {
+                //The battle ends earlier than when it was recorded
+                return false;
+            }
+            ended = BattleEngine::resolveTurn(state, getTurn(turn), log);
+        }
+        if(ended != over) {
+            return false;
+        }
+        for(int i = 0; i < state.count && over; i++) {
+            if(state.combatants[i].hp != finalHp[i]) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    void BattleReplay::save(std::string const &path) const {
+        std::ofstream stream(path, std::ios::binary);
+        if(!stream) {
+            throw Utils::LoadingException(path, false);
+        }
+        stream.write(REPLAY_MAGIC, 4);
+        write<std::uint16_t>(stream, REPLAY_VERSION);
+        write<std::uint64_t>(stream, seed);
+        write<std::uint8_t>(stream, opmons.size());
+        for(ReplayOpMon const &opmon : opmons) {
+            write<std::uint32_t>(stream, opmon.species);
+            writeString(stream, opmon.nickname);
+            for(std::string const &move : opmon.moves) {
+                writeString(stream, move);
+            }
+            writeCombatant(stream, opmon.start);
+        }
+        write<std::uint32_t>(stream, getTurnCount());
+        for(BattleChoice const &choice : choices) {
+            write<std::uint8_t>(stream, (int)choice.type);
+            write<std::uint8_t>(stream, choice.move);
+            write<std::uint8_t>(stream, choice.target);
+        }
+        write<std::uint8_t>(stream, over);
+        for(int hp : finalHp) {
+            write<std::int32_t>(stream, hp);
+        }
+        if(!stream) {
+            throw Utils::LoadingException(path, false);
+        }
+    }
+
+    BattleReplay BattleReplay::load(std::string const &path) {
+        std::ifstream stream(path, std::ios::binary);
+        char magic[4];
+        if(!stream.read(magic, 4)) {
+            throw Utils::LoadingException(path, false);
+        }
+        if(std::string(magic, 4) != REPLAY_MAGIC) {
+            throw Utils::UnexpectedValueException(path, "a replay file", false);
+        }
+        int version = read<std::uint16_t>(stream);
+        if(version != REPLAY_VERSION) {
+            throw Utils::UnexpectedValueException("version " + std::to_string(version), "a replay of version " + std::to_string(REPLAY_VERSION), false);
+        }
+
+        BattleReplay replay;
+        replay.seed = read<std::uint64_t>(stream);
+        int count = read<std::uint8_t>(stream);
+        if(count < 2 || count > BATTLE_MAX_COMBATANTS) {
+            throw Utils::UnexpectedValueException(std::to_string(count) + " OpMons", "from 2 to " + std::to_string(BATTLE_MAX_COMBATANTS) + " OpMons in a replay", false);
+        }
+        replay.opmons.resize(count);
+        for(ReplayOpMon &opmon : replay.opmons) {
+            opmon.species = read<std::uint32_t>(stream);
+            opmon.nickname = readString(stream);
+            for(std::string &move : opmon.moves) {
+                move = readString(stream);
+            }
+            opmon.start = readCombatant(stream);
+            checkCombatant(opmon.start, count);
+        }
+        std::uint32_t turns = read<std::uint32_t>(stream);
+        for(std::uint64_t i = 0; i < (std::uint64_t)turns * count && stream; i++) {
+            BattleChoice choice;
+            choice.type = (Elements::TurnType)read<std::uint8_t>(stream);
+            choice.move = read<std::uint8_t>(stream);
+            choice.target = read<std::uint8_t>(stream);
+            checkChoice(choice, replay.opmons[i % count], count);
+            replay.choices.push_back(choice);
+        }
+        replay.over = read<std::uint8_t>(stream) != 0;
+        for(int i = 0; i < count && replay.over; i++) {
+            replay.finalHp.push_back(read<std::int32_t>(stream));
+        }
+        if(!stream) {
+            throw Utils::LoadingException(path, false);
+        }
+        return replay;
+    }
+
+} // namespace OpMon
@@ -0,0 +1,138 @@
+/*!
+ * \file BattleReplay.hpp
+ * \author Cyrielle
+ * \copyright GNU GPL v3.0
+ */
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "BattleEngine.hpp"
+
+/*!
+ * \brief The version of the replay files written by BattleReplay::save. Increase it each time the format changes.
+ */
+#define REPLAY_VERSION 2
+/*!
+ * \brief The extension of the replay files.
+ */
+#define REPLAY_EXTENSION ".oprp"
+
+namespace OpMon {
+
+    class OpMon;
+
+    /*!
+     * \brief The data needed to recreate an OpMon of a replay.
+     */
+    struct ReplayOpMon {
+        /*!
+         * \brief The Opdex number of the species, used to show the OpMon.
+         */
+        unsigned int species;
+        std::string nickname;
+        /*!
+         * \brief The identifiers of the moves in Move::moveList, empty if there is no move in the slot.
+         */
+        std::string moves[4];
+        /*!
+         * \brief The state of the OpMon when the battle starts. The pointers to the moves are not used.
+         */
+        Combatant start;
+    };
+
+    /*!
+     * \brief A battle recorded with its seed, its OpMons and the choices of each turn.
+     * \details The OpMons and the choices are indexed like BattleState::combatants.
+     *
+     * As BattleEngine::resolveTurn only depends on the state and the choices, the battle can be played again exactly, with BattleCtrl to show it, or only
+     * with the engine to check that the rules still give the same outcome (see verify()).
+     *
+     * The file starts with the magic bytes `OPRP` and the version of the format. All the numbers are stored in little endian.
+     */
+    class BattleReplay {
+      public:
+        /*!
+         * \brief Starts recording a battle.
+         * \param state The state at the beginning of the battle.
+         * \param opmons The fighting OpMons, `state.count` of them.
+         */
+        void start(BattleState const &state, OpMon *const opmons[]);
+        /*!
+         * \brief Records the choices of all the combatants for a turn.
+         */
+        void addTurn(BattleChoice const choices[]);
+        /*!
+         * \brief Records the state at the end of the battle, compared by verify().
+         */
+        void end(BattleState const &state);
+
+        /*!
+         * \brief Returns the number of fighting OpMons.
+         */
+        int getCount() const {
+            return opmons.size();
+        }
+        std::size_t getTurnCount() const {
+            return opmons.empty() ? 0 : choices.size() / opmons.size();
+        }
+        /*!
+         * \brief Returns the choices of all the combatants for a turn.
+         */
+        BattleChoice const *getTurn(std::size_t turn) const {
+            return &choices[turn * opmons.size()];
+        }
+        ReplayOpMon const &getOpMon(int index) const {
+            return opmons[index];
+        }
+        /*!
+         * \brief Returns the state at the beginning of the battle, using the moves of the given OpMons.
+         * \param opmons The OpMons created from the replay, getCount() of them.
+         */
+        BattleState getStartState(OpMon *const opmons[]) const;
+
+        /*!
+         * \brief Plays the battle again with BattleEngine, without showing it.
+         * \details The moves are created from Move::moveList, which has to be loaded.
+         * \returns `true` if the battle ends at the same turn with the same HP as when it was recorded.
+         */
+        bool verify() const;
+
+        /*!
+         * \brief Writes the replay in a file.
+         * \throws Utils::LoadingException if the file can't be written.
+         */
+        void save(std::string const &path) const;
+        /*!
+         * \brief Reads a replay from a file.
+         * \throws Utils::LoadingException if the file can't be read.
+         * \throws Utils::UnexpectedValueException if the file is not a replay, has another version, or contains a value out of its range
+         * (a move slot without move, a type, a status or a stage which doesn't exist...).
+         */
+        static BattleReplay load(std::string const &path);
+
+      private:
+        /*!
+         * \brief Returns the state at the beginning of the battle, with the given moves.
+         */
+        BattleState makeState(std::vector<Move *> const moves[]) const;
+
+        std::vector<ReplayOpMon> opmons;
+        std::uint64_t seed = 0;
+        /*!
+         * \brief The choices of all the combatants, one turn after the other.
+         */
+        std::vector<BattleChoice> choices;
+        /*!
+         * \brief `true` if the battle has been recorded until its end.
+         */
+        bool over = false;
+        /*!
+         * \brief The HP of the OpMons at the end of the battle.
+         */
+        std::vector<int> finalHp;
+    };
+
+} // namespace OpMon
@@ -0,0 +1,157 @@
+/*
+DamageBatch.cpp
+Author : Cyrielle
+File under GNU GPL v3.0 license
+*/
+#include "DamageBatch.hpp"
+
+#include <algorithm>
+
+#include "BattleEngine.hpp"
+#include "Move.hpp"
+#include "Moves.hpp"
+
+namespace OpMon {
+
+    std::size_t DamageBatch::add(Combatant const &attacker, Combatant const &defender, Move const &move) {
+        level.push_back(attacker.level);
+        attack.push_back(BattleEngine::getStat(attacker, move.isSpecial() ? Stats::ATKSPE : Stats::ATK));
+        defense.push_back(BattleEngine::getStat(defender, move.isSpecial() ? Stats::DEFSPE : Stats::DEF));
+        power.push_back(move.getPower());
+        stab.push_back(move.getType() == attacker.types[0] || move.getType() == attacker.types[1]);
+        float moveEffectiveness = ArrayTypes::calcEffectiveness(move.getType(), defender.types[0], defender.types[1]);
+        effectiveness.push_back(moveEffectiveness * 4);
+        //BattleEngine::roll(state, criticalRate) == 1 can only happen if the rate is at least 2
+        criticalChance.push_back(move.getCriticalRate() > 1 ? 1.0f / move.getCriticalRate() : 0.0f);
+
+        float hit = 1;
+        if(move.isStatus() || moveEffectiveness == 0) {
+            hit = 0;
+        } else if(!move.isNeverFailing()) {
+            //The move hits if a roll in [0, 99] is at most this threshold
+            int threshold = move.getAccuracy() * (BattleEngine::getStat(attacker, Stats::ACC) / BattleEngine::getStat(defender, Stats::EVA));
+            hit = std::clamp(threshold + 1, 0, 100) / 100.0f;
+        }
+        hitChance.push_back(hit);
+        hp.push_back(defender.hp);
+
+        //Like in BattleEngine, the last EffectOp::MULTI_HIT applied before the damages gives the number of hits
+        int hitsMin = 1;
+        int hitsMax = 1;
+        for(Moves::Effect const &effect : move.getEffects().get(Moves::EffectPhase::PRE)) {
+            if(effect.op == Moves::EffectOp::MULTI_HIT) {
+                hitsMin = effect.a;
+                hitsMax = effect.b;
+            }
+        }
+        minHits.push_back(hitsMin);
+        maxHits.push_back(hitsMax);
+        return size() - 1;
+    }
+
+    void DamageBatch::clear() {
+        level.clear();
+        attack.clear();
+        defense.clear();
+        power.clear();
+        stab.clear();
+        effectiveness.clear();
+        criticalChance.clear();
+        hitChance.clear();
+        hp.clear();
+        minHits.clear();
+        maxHits.clear();
+    }
+
+    void DamageBatch::estimate() {
+        std::size_t count = size();
+        normalBase.resize(count);
+        criticalBase.resize(count);
+        normalSum.assign(count, 0);
+        criticalSum.assign(count, 0);
+        normalKo.assign(count, 0);
+        criticalKo.assign(count, 0);
+        minDamage.resize(count);
+        maxDamage.resize(count);
+        expectedDamage.resize(count);
+        koChance.resize(count);
+
+        //Each loop works on whole arrays, with no branch, so it can be vectorized.
+        for(std::size_t i = 0; i < count; i++) {
+            normalBase[i] = BattleEngine::baseDamage(level[i], attack[i], defense[i], power[i], stab[i], effectiveness[i], false);
+        }
+        for(std::size_t i = 0; i < count; i++) {
+            criticalBase[i] = BattleEngine::criticalDamage(normalBase[i]);
+        }
+        for(int roll = 0; roll < 16; roll++) {
+            for(std::size_t i = 0; i < count; i++) {
+                int normal = BattleEngine::rollDamage(normalBase[i], roll);
+                normalSum[i] += normal;
+                normalKo[i] += normal >= hp[i];
+            }
+            for(std::size_t i = 0; i < count; i++) {
+                int critical = BattleEngine::rollDamage(criticalBase[i], roll);
+                criticalSum[i] += critical;
+                criticalKo[i] += critical >= hp[i];
+            }
+        }
+        for(std::size_t i = 0; i < count; i++) {
+            float critical = criticalChance[i];
+            bool canHit = hitChance[i] > 0;
+            minDamage[i] = canHit ? BattleEngine::rollDamage(normalBase[i], 0) : 0;
+            maxDamage[i] = canHit ? BattleEngine::rollDamage(critical > 0 ? criticalBase[i] : normalBase[i], 15) : 0;
+            expectedDamage[i] = hitChance[i] * ((1 - critical) * normalSum[i] + critical * criticalSum[i]) / 16;
+            koChance[i] = hitChance[i] * ((1 - critical) * normalKo[i] + critical * criticalKo[i]) / 16;
+        }
+        for(std::size_t i = 0; i < count; i++) {
+            if(maxHits[i] > 1 && hitChance[i] > 0 && hp[i] > 0) {
+                estimateHits(i);
+            }
+        }
+    }
+
+    void DamageBatch::estimateHits(std::size_t i) {
+        //The 32 possible damages of a hit, with their probabilities
+        float critical = criticalChance[i];
+        int damages[32];
+        float chances[32];
+        for(int roll = 0; roll < 16; roll++) {
+            damages[roll] = BattleEngine::rollDamage(normalBase[i], roll);
+            chances[roll] = (1 - critical) / 16;
+            damages[roll + 16] = BattleEngine::rollDamage(criticalBase[i], roll);
+            chances[roll + 16] = critical / 16;
+        }
+
+        //alive[h] is the probability that the defender has h HP left after the previous hits, if the move hits enough times
+        alive.assign(hp[i] + 1, 0);
+        alive[hp[i]] = 1;
+        float damage = 0;
+        float ko = 0;
+        for(int hit = 1; hit <= maxHits[i]; hit++) {
+            //The probability that the move hits at least this number of times
+            float happens = hit <= minHits[i] ? 1 : (float)(maxHits[i] - hit + 1) / (maxHits[i] - minHits[i] + 1);
+            nextAlive.assign(hp[i] + 1, 0);
+            for(int left = 1; left <= hp[i]; left++) {
+                if(alive[left] == 0) {
+                    continue;
+                }
+                for(int outcome = 0; outcome < 32; outcome++) {
+                    float chance = alive[left] * chances[outcome];
+                    damage += happens * chance * damages[outcome];
+                    if(damages[outcome] >= left) {
+                        ko += happens * chance;
+                    } else {
+                        nextAlive[left - damages[outcome]] += chance;
+                    }
+                }
+            }
+            alive.swap(nextAlive);
+        }
+
+        minDamage[i] = std::min(minDamage[i] * minHits[i], hp[i]);
+        maxDamage[i] *= maxHits[i];
+        expectedDamage[i] = hitChance[i] * damage;
+        koChance[i] = hitChance[i] * ko;
+    }
+
+} // namespace OpMon
@@ -0,0 +1,109 @@
+/*!
+ * \file DamageBatch.hpp
+ * \author Cyrielle
+ * \copyright GNU GPL v3.0
+ */
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace OpMon {
+
+    struct Combatant;
+    class Move;
+
+    /*!
+     * \brief A list of (attacker, defender, move) triples whose damages are estimated together by DamageBatch::estimate.
+     * \details The data is stored in one array per field, so the estimation works on contiguous arrays the compiler can vectorize.
+     * Only the data used by the damage formula and the number of hits of the move (see Moves::EffectOp::MULTI_HIT) are stored : the other effects are ignored.
+     * In particular, the damages taken by the attacker with Moves::EffectOp::RECOIL are not estimated.
+     */
+    class DamageBatch {
+      public:
+        /*!
+         * \brief Adds a move used by an OpMon on another one.
+         * \returns The index of the triple in the results.
+         */
+        std::size_t add(Combatant const &attacker, Combatant const &defender, Move const &move);
+        void clear();
+        std::size_t size() const {
+            return level.size();
+        }
+
+        /*!
+         * \brief Estimates the damages of all the triples.
+         * \details The results are exactly the ones of BattleEngine::calcDamage, which uses the same functions. For each triple, the 16 damage rolls and the critical hit
+         * are enumerated with their probabilities, instead of being drawn.
+         *
+         * The moves hitting several times are then estimated hit by hit, like BattleEngine does : the number of hits is uniform in its range, and the hits stop when the defender is knocked out.
+         */
+        void estimate();
+
+        /*!
+         * \brief The smallest damages of the move, or 0 if the move can't hurt.
+         * \details For a move hitting several times, it is the smallest hit times the minimum number of hits, but no more than the HP of the defender, as the hits stop when it is knocked out.
+         */
+        std::vector<int> minDamage;
+        /*!
+         * \brief The biggest damages of the move, critical if the move can do critical hits.
+         * \details For a move hitting several times, it is the biggest hit times the maximum number of hits.
+         */
+        std::vector<int> maxDamage;
+        /*!
+         * \brief The average damages, including the chance of missing.
+         */
+        std::vector<float> expectedDamage;
+        /*!
+         * \brief The probability of knocking out the defender, including the chance of missing.
+         */
+        std::vector<float> koChance;
+
+      private:
+        std::vector<int> level;
+        std::vector<int> attack;
+        std::vector<int> defense;
+        std::vector<int> power;
+        std::vector<int> stab;
+        /*!
+         * \brief The effectiveness of the moves, multiplied by 4.
+         */
+        std::vector<int> effectiveness;
+        /*!
+         * \brief The probability of a critical hit.
+         */
+        std::vector<float> criticalChance;
+        /*!
+         * \brief The probability of hitting.
+         */
+        std::vector<float> hitChance;
+        /*!
+         * \brief The HP of the defender.
+         */
+        std::vector<int> hp;
+        /*!
+         * \brief The range of the number of hits of the moves, 1 to 1 if the move doesn't have EffectOp::MULTI_HIT.
+         */
+        std::vector<int> minHits;
+        std::vector<int> maxHits;
+
+        /*!
+         * \brief Replaces the results of a triple whose move hits several times.
+         * \details The distribution of the HP left to the defender is calculated after each hit, with the 16 rolls and the critical hit of the hit.
+         */
+        void estimateHits(std::size_t i);
+
+        //Intermediate results of estimate()
+        std::vector<int> normalBase;
+        std::vector<int> criticalBase;
+        std::vector<int> normalSum;
+        std::vector<int> criticalSum;
+        std::vector<int> normalKo;
+        std::vector<int> criticalKo;
+        //Intermediate results of estimateHits(), indexed by the HP left to the defender
+        std::vector<float> alive;
+        std::vector<float> nextAlive;
+    };
+
+} // namespace OpMon
@@ -38,6 +38,12 @@ namespace OpMon {
         }
     }
 
+    std::string Move::getId() const {
+        //The keys are "moves.<id>.name" (see initMoves)
+        std::string const &key = nameKey.getKey();
+        return (key.size() > 11) ? key.substr(6, key.size() - 11) : key;
+    }
+
     void Move::initMoves(std::filesystem::directory_iterator dir) {
     	for(std::filesystem::directory_entry const& file : dir) {
     		if(file.is_regular_file()){
@@ -48,7 +54,6 @@ namespace OpMon {
 
     			for(auto itor = json.begin(); itor != json.end(); ++itor) {
     				std::string idStr = itor->at("id");
-    				std::vector<MoveEffect **> effects = {&moveList[idStr].preEffect, &moveList[idStr].postEffect, &moveList[idStr].ifFails};
     				moveList[idStr].nameKey = std::string("moves.") + idStr + ".name";
     				moveList[idStr].power = itor->at("power");
     				moveList[idStr].type = itor->at("type");
@@ -59,14 +64,10 @@ namespace OpMon {
     				moveList[idStr].neverFails = itor->at("neverFails");
     				moveList[idStr].ppMax = itor->at("ppMax");
     				moveList[idStr].priority = itor->at("priority");
+    				//The effects are given in the order of Moves::EffectPhase : before the damages, after the damages and if the move fails.
     				int i = 0;
-    				for(auto eitor = itor->at("effects").begin(); eitor != itor->at("effects").end(); ++eitor) {
-    					if(!eitor->at("null")) {
-    						std::string effectType = eitor->at("type");
-    						if(effectType == "ChangeStatEffect") {
-    							*(effects[i]) = new Moves::ChangeStatEffect(eitor->at("data"));
-    						}
-    					}
+    				for(auto eitor = itor->at("effects").begin(); eitor != itor->at("effects").end() && i < 3; ++eitor) {
+    					moveList[idStr].effects.compile((Moves::EffectPhase)i, *eitor);
     					i++;
     				}
     				for(unsigned int i = 0; i < itor->at("animationOrder").size(); i++) {
@@ -131,7 +132,7 @@ namespace OpMon {
         return opAnimsDef;
     }
 
-    Move::Move(std::string nameKey, int power, Type type, int accuracy, bool special, bool status, int criticalRate, bool neverFails, int ppMax, int priority, std::vector<Elements::TurnActionType> animationOrder, std::queue<Ui::Transformation> opAnimsAtk, std::queue<Ui::Transformation> opAnimsDef, std::queue<std::string> animations, MoveEffect *preEffect, MoveEffect *postEffect, MoveEffect *fails)
+    Move::Move(std::string nameKey, int power, Type type, int accuracy, bool special, bool status, int criticalRate, bool neverFails, int ppMax, int priority, std::vector<Elements::TurnActionType> animationOrder, std::queue<Ui::Transformation> opAnimsAtk, std::queue<Ui::Transformation> opAnimsDef, std::queue<std::string> animations, Moves::EffectList effects)
         : nameKey(Utils::OpString(stringkeys, nameKey))
         , name(this->nameKey.getString(stringkeys))
         , power(power)
@@ -144,9 +145,7 @@ namespace OpMon {
         , pp(ppMax)
         , ppMax(ppMax)
         , priority(priority)
-        , preEffect(preEffect)
-        , postEffect(postEffect)
-        , failEffect(fails)
+        , effects(std::move(effects))
         , animationOrder(animationOrder)
         , opAnimsAtk(opAnimsAtk)
         , opAnimsDef(opAnimsDef)
@@ -166,90 +165,12 @@ namespace OpMon {
         , pp(data.ppMax)
         , ppMax(data.ppMax)
         , priority(data.priority)
-        , preEffect(data.preEffect)
-        , postEffect(data.postEffect)
-        , failEffect(data.ifFails)
+        , effects(data.effects)
         , animationOrder(data.animationOrder)
         , opAnimsAtk(data.opAnimsAtk)
         , opAnimsDef(data.opAnimsDef)
         , animations(data.animations) {}
 
-    Move::~Move() {
-        delete(this->preEffect);
-        delete(this->postEffect);
-        delete(this->failEffect);
-    }
-
-    /* Return 1 : Inform to do the same move at the next turn.
-     * Return 2 : End the move
-     * Return -2 : Inform that the move failed
-     * Return -1 : Inform that the move was ineffective against the target
-     * In effectAfter : Return any number except 1 act like return 2.
-     * If 1 is returned, it will do the same move at the next turn.
-     * TODO : Create defines to make this more clear
-     */
-    int Move::move(OpMon &atk, OpMon &def, std::queue<Elements::TurnAction> &turnQueue, bool attacker) {
-        pp--;
-        turnQueue.push(Elements::createTurnDialogAction(Utils::OpString(stringkeys, "battle.dialog.move", {atk.getNicknamePtr(), &name})));
-        //Move fail
-        if((Utils::Misc::randU(100)) > (accuracy * (atk.getStatACC() / def.getStatEVA())) && neverFails == false) {
-            Elements::TurnAction failAction;
-            turnQueue.push(Elements::createTurnDialogAction(Utils::OpString(stringkeys, "battle.dialog.fail", {atk.getNicknamePtr()})));
-            failEffect->apply(*this, atk, def, turnQueue);
-            return -2;
-        }
-        int effectBf = preEffect ? preEffect->apply(*this, atk, def, turnQueue) : 0;
-        if(effectBf == 1 || effectBf == 2) { //If special returns 1 or 2, the move ends.
-            return effectBf;
-        }
-        //If type unefficiency
-        if(ArrayTypes::calcEffectiveness(type, def.getType1(), def.getType2()) == 0 && (neverFails == false || status == false)) {
-            turnQueue.push(Elements::createTurnDialogAction(Utils::OpString(stringkeys, "battle.effectiveness.none", {atk.getNicknamePtr()})));
-            if(failEffect != nullptr)
-                failEffect->apply(*this, atk, def, turnQueue);
-            return -1;
-        }
-
-        //Animation time
-        for(Elements::TurnActionType tat : animationOrder) {
-            Elements::TurnAction ta;
-            ta.type = tat;
-            turnQueue.push(ta);
-        }
-
-        if(!status) { //Check if it isn't a status move to calculate the hp lost
-            hpLost = (((atk.getLevel() * 0.4 + 2) * (special ? atk.getStatATKSPE() : atk.getStatATK()) * power) / ((special ? def.getStatDEFSPE() : def.getStatDEF()) * 50) + 2);
-            if(type == atk.getType1() || type == atk.getType2()) {
-                hpLost = round(hpLost * 1.5);
-            }
-            float effectiveness = (ArrayTypes::calcEffectiveness(type, def.getType1(), def.getType2()));
-            //if(effectiveness)//Set effectiveness dialogs here
-            hpLost = round(hpLost * effectiveness);
-            if(Utils::Misc::randU(criticalRate) == 1) {
-                hpLost = round(hpLost * 1.5);
-            }
-            hpLost = round(hpLost * (Utils::Misc::randU(100 - 85 + 1) + 85) / 100);
-
-            def.attacked(hpLost);
-
-            Elements::TurnAction loosingHp;
-            newTurnAction(&loosingHp);
-            loosingHp.type = attacker ? Elements::TurnActionType::DEF_UPDATE_HBAR : Elements::TurnActionType::ATK_UPDATE_HBAR;
-            loosingHp.hpLost = hpLost;
-            turnQueue.push(loosingHp);
-
-            if(effectiveness == 0.25)
-                turnQueue.push(Elements::createTurnDialogAction(Utils::OpString(stringkeys, "battle.effectiveness.almostnone")));
-            else if(effectiveness == 0.5)
-                turnQueue.push(Elements::createTurnDialogAction(Utils::OpString(stringkeys, "battle.effectiveness.notvery")));
-            else if(effectiveness == 2)
-                turnQueue.push(Elements::createTurnDialogAction(Utils::OpString(stringkeys, "battle.effectiveness.very")));
-            else if(effectiveness == 4)
-                turnQueue.push(Elements::createTurnDialogAction(Utils::OpString(stringkeys, "battle.effectiveness.super")));
-        }
-        return postEffect ? postEffect->apply(*this, atk, def, turnQueue) : 0;
-    }
-
     void Move::onLangChanged(){
     	name = nameKey.getString(stringkeys);
     }
@@ -9,28 +9,18 @@
 #define SRCCPP_JLPPC_REGIMYS_OBJECTS_ATTAQUE_HPP_
 
 #include <queue>
+#include <vector>
 #include <filesystem>
 
 #include "../view/ui/Elements.hpp"
 #include "../view/elements/Turn.hpp"
+#include "Moves.hpp"
 #include "src/utils/i18n/ATranslatable.hpp"
 
 namespace OpMon {
 
     class OpMon;
-class Move;
-
-    /*!
-     * \brief This class is virtual and one has to be created for each move effect.
-     */
-    class MoveEffect {
-    public:
-        /*!
-          \brief Applies the effect.
-        */
-        virtual int apply(Move & /*move*/, OpMon & /*attacker*/, OpMon & /*defender*/, std::queue<Elements::TurnAction> & /* turnQueue */) { return 0; }
-        virtual ~MoveEffect() {}
-    };
+    class Move;
 
     /*!
      * \struct MoveData
@@ -48,9 +38,7 @@ class Move;
         bool neverFails; /*!< \brief  If `true`, the move can't fail.*/
         int ppMax; /*!< \brief The maximum base PP (Power points) of the move.*/
         int priority; /*!< \brief The level of priority of the move.*/
-        MoveEffect *preEffect = nullptr; /*!< \brief The move effect applied before the calculation of the damages.*/
-        MoveEffect *postEffect = nullptr; /*!< \brief The move effect applied after the calculation of the damages.*/
-        MoveEffect *ifFails = nullptr; /*!< \brief The move effect applied if the move fails.*/
+        Moves::EffectList effects; /*!< \brief The effects of the move, applied before and after the calculation of the damages, or if the move fails.*/
         std::vector<Elements::TurnActionType> animationOrder; /*!< \brief The order in which the animations will occur.*/
         std::queue<Ui::Transformation> opAnimsAtk; /*!< \brief The animations linked to the attacking OpMon's sprite.*/
         std::queue<Ui::Transformation> opAnimsDef; /*!< \brief The animations linked to the attacked OpMon's sprite.*/
@@ -67,12 +55,12 @@ class Move;
      */
     class Move : public Utils::I18n::ATranslatable{
     public:
-        virtual ~Move();
+        virtual ~Move() = default;
         /*!
          * \brief Creates an move with all the needed data.
          * \note To see the details of the parameters, see MoveData.
          */
-        Move(std::string nameKey, int power, Type type, int accuracy, bool special, bool status, int criticalRate, bool neverFails, int ppMax, int priority, std::vector<Elements::TurnActionType> animationOrder, std::queue<Ui::Transformation> opAnimsAtk, std::queue<Ui::Transformation> opAnimsDef, std::queue<std::string> animations, MoveEffect *preEffect = nullptr, MoveEffect *postEffect = nullptr, MoveEffect *fails = nullptr);
+        Move(std::string nameKey, int power, Type type, int accuracy, bool special, bool status, int criticalRate, bool neverFails, int ppMax, int priority, std::vector<Elements::TurnActionType> animationOrder, std::queue<Ui::Transformation> opAnimsAtk, std::queue<Ui::Transformation> opAnimsDef, std::queue<std::string> animations, Moves::EffectList effects = Moves::EffectList());
 
         /*!
          * \brief Creates and move with all the data stored in the MoveData structure.
@@ -97,27 +85,18 @@ class Move;
             pp = ppMax;
         }
 
-        Type getType() {
+        Type getType() const {
             return type;
         }
 
-        int getPP() {
+        int getPP() const {
             return pp;
         }
 
-        int getPPMax() {
+        int getPPMax() const {
             return ppMax;
         }
 
-        /*!
-         * \brief Causes a OpMon to move another one.
-         * \param atk A reference to the OpMon using the move.
-         * \param def A reference to the opposite OpMon.
-         * \param turnQueue A reference to the action queue of the turn.
-         * \param attacker If `true`, the OpMon attacking is the player's one (The one on the front of the screen.). Used to determine which health bar update.
-         */
-        int move(OpMon &atk, OpMon &def, std::queue<Elements::TurnAction> &turnQueue, bool attacker);
-
         void setPP(int PP) {
             this->pp = PP;
         }
@@ -126,14 +105,56 @@ class Move;
             this->ppMax = PPMax;
         }
 
-        int getPriority() {
+        int getPriority() const {
             return this->priority;
         }
 
-        sf::String getName() {
+        sf::String getName() const {
             return name;
         }
 
+        /*!
+         * \brief Returns a pointer to the name of the move, to be used in the dialogs.
+         */
+        sf::String *getNamePtr() {
+            return &name;
+        }
+        /*!
+         * \brief Returns the identifier of the move in Move::moveList.
+         */
+        std::string getId() const;
+
+        int getPower() const {
+            return power;
+        }
+
+        bool isSpecial() const {
+            return special;
+        }
+
+        bool isStatus() const {
+            return status;
+        }
+
+        int getCriticalRate() const {
+            return criticalRate;
+        }
+
+        bool isNeverFailing() const {
+            return neverFails;
+        }
+
+        /*!
+         * \brief Returns the effects of the move, compiled when the moves are loaded.
+         */
+        Moves::EffectList const &getEffects() const {
+            return effects;
+        }
+
+        std::vector<Elements::TurnActionType> const &getAnimationOrder() const {
+            return animationOrder;
+        }
+
         std::queue<Ui::Transformation> getOpAnimsAtk() const {
             return opAnimsAtk;
         }
@@ -150,11 +171,10 @@ class Move;
 
 
         void setPower(int power) { this->power = power; }
-        int getAccuracy() { return this->accuracy; }
+        int getAccuracy() const { return this->accuracy; }
         void setAccuracy(int accuracy) { this->accuracy = accuracy; }
         int getPart() { return part; }
         void setPart(int part) { this->part = part; }
-        int getHpLost() { return this->hpLost; }
 
         void onLangChanged();
 
@@ -171,18 +191,12 @@ class Move;
         int pp;/*!<\brief The current pp of the move.*/
         int ppMax; /*!< \brief The maximum base PP (Power points) of the move.*/
         int priority; /*!< \brief The level of priority of the move.*/
-        MoveEffect *preEffect; /*!< \brief The move effect applied before the calculation of the damages.*/
-        MoveEffect *postEffect; /*!< \brief The move effect applied after the calculation of the damages.*/
-        MoveEffect *failEffect; /*!< \brief The move effect applied if the move fails.*/
+        Moves::EffectList effects; /*!< \brief The effects of the move, applied before and after the calculation of the damages, or if the move fails.*/
         std::vector<Elements::TurnActionType> animationOrder; /*!< \brief The order in which the animations will occur.*/
         std::queue<Ui::Transformation> opAnimsAtk; /*!< \brief The animations linked to the attacking OpMon's sprite.*/
         std::queue<Ui::Transformation> opAnimsDef; /*!< \brief The animations linked to the attacked OpMon's sprite.*/
         std::queue<std::string> animations; /*!< \brief The animations played on the whole screen.*/
 
-        /*!
-         * \brief The number of HP lost by the opposite OpMon.
-         */
-        int hpLost = 0;
         /*!
          * \brief Used for moves in multiple turns.
          */
@@ -10,63 +10,215 @@
 #include <map>
 
 #include "src/nlohmann/json.hpp"
-#include "src/opmon/model/OpMon.hpp"
-#include "src/utils/OpString.hpp"
+#include "../../utils/exceptions.hpp"
+#include "BattleEngine.hpp"
+#include "BattleLog.hpp"
 
-namespace OpMon {
-class Move;
-}  // namespace OpMon
-
-#pragma GCC diagnostic ignored "-Wunused-parameter"
 namespace OpMon {
 
     namespace Moves {
 
         using namespace Utils;
 
-        ChangeStatEffect::ChangeStatEffect(Target target, Stats stat, int coef)
-            : target(target)
-            , stat(stat)
-            , coef(coef) {}
+        namespace {
 
-        ChangeStatEffect::ChangeStatEffect(nlohmann::json const &data)
-            : target(data.at("target"))
-            , stat(data.at("stat"))
-            , coef(data.at("coef")) {
-        }
+            /*!
+             * \brief Reads the probability of an effect, 100 if it isn't given.
+             */
+            std::uint8_t readChance(nlohmann::json const &data) {
+                return (std::uint8_t)std::clamp(data.value("chance", 100), 0, 100);
+            }
+
+            //The targets are 0 for the user and 1 for the target of the move, as in the former ChangeStatEffect.
+            bool readOnUser(nlohmann::json const &data, int byDefault) {
+                return data.value("target", byDefault) == 0;
+            }
+
+            /*!
+             * \brief Reads a value of an effect, used as an index by the handlers.
+             * \throws Utils::UnexpectedValueException if the value is not in [min, max].
+             */
+            std::int16_t readRange(nlohmann::json const &data, char const *key, int min, int max) {
+                int value = data.at(key);
+                if(value < min || value > max) {
+                    throw UnexpectedValueException(std::string(key) + " " + std::to_string(value), std::string(key) + " in [" + std::to_string(min) + ", " + std::to_string(max) + "]", false);
+                }
+                return (std::int16_t)value;
+            }
+
+            Effect compileChangeStat(nlohmann::json const &data) {
+                //Stats::NOTHING (0) is not a stat
+                return {EffectOp::CHANGE_STAT, readOnUser(data, 0), readChance(data), readRange(data, "stat", 1, (int)Stats::EVA), (std::int16_t)(int)data.at("coef")};
+            }
+
+            Effect compileStatus(nlohmann::json const &data) {
+                return {EffectOp::STATUS, readOnUser(data, 1), readChance(data), readRange(data, "status", (int)Status::BURNING, (int)Status::POISONED), 0};
+            }
+
+            Effect compileConfuse(nlohmann::json const &data) {
+                return {EffectOp::CONFUSE, readOnUser(data, 1), readChance(data), 0, 0};
+            }
+
+            Effect compileFlinch(nlohmann::json const &data) {
+                return {EffectOp::FLINCH, readOnUser(data, 1), readChance(data), 0, 0};
+            }
+
+            Effect compileHeal(nlohmann::json const &data) {
+                return {EffectOp::HEAL, readOnUser(data, 0), readChance(data), readRange(data, "percent", 0, 100), 0};
+            }
+
+            Effect compileRecoil(nlohmann::json const &data) {
+                return {EffectOp::RECOIL, readOnUser(data, 0), readChance(data), readRange(data, "percent", 0, 100), 0};
+            }
+
+            Effect compileMultiHit(nlohmann::json const &data) {
+                int min = std::max(1, data.at("min").get<int>());
+                return {EffectOp::MULTI_HIT, true, 100, (std::int16_t)min, (std::int16_t)std::max(min, data.at("max").get<int>())};
+            }
+
+            int getSide(Effect const &effect, EffectContext const &context) {
+                return effect.onUser ? context.user : context.target;
+            }
 
-        int ChangeStatEffect::apply(Move &, OpMon &attacker, OpMon &defender, std::queue<Elements::TurnAction> &turnQueue) {
-            std::map<Stats, int (OpMon::*)(int)> stat_to_method = {
-                {Stats::ACC, &OpMon::changeACC},
-                {Stats::ATK, &OpMon::changeATK},
-                {Stats::ATKSPE, &OpMon::changeATKSPE},
-                {Stats::DEF, &OpMon::changeDEF},
-                {Stats::DEFSPE, &OpMon::changeDEFSPE},
-                {Stats::EVA, &OpMon::changeEVA},
-                {Stats::SPE, &OpMon::changeSPE},
+            bool changeStat(Effect const &effect, EffectContext &context) {
+                // TODO : Add dialog if stat is at its min/max
+                int changed = getSide(effect, context);
+                BattleEngine::changeStage(context.state.combatants[changed], (Stats)effect.a, effect.b);
+                context.log.push_back({BattleLogType::STAT_CHANGE, (std::uint8_t)changed, effect.a, effect.b});
+                return true;
+            }
+
+            bool inflictStatus(Effect const &effect, EffectContext &context) {
+                int side = getSide(effect, context);
+                Combatant &combatant = context.state.combatants[side];
+                if(combatant.hp > 0 && combatant.status == Status::NOTHING) {
+                    combatant.status = (Status)effect.a;
+                    if(combatant.status == Status::SLEEPING) {
+                        combatant.sleepingCD = BattleEngine::roll(context.state, 3);
+                    }
+                    context.log.push_back({BattleLogType::STATUS, (std::uint8_t)side, effect.a, 0});
+                }
+                return true;
+            }
+
+            bool confuse(Effect const &effect, EffectContext &context) {
+                int side = getSide(effect, context);
+                Combatant &combatant = context.state.combatants[side];
+                if(combatant.hp > 0 && !combatant.confused) {
+                    combatant.confused = true;
+                    combatant.confusedCD = BattleEngine::roll(context.state, 4);
+                    context.log.push_back({BattleLogType::CONFUSED, (std::uint8_t)side, 0, 0});
+                }
+                return true;
+            }
+
+            bool flinch(Effect const &effect, EffectContext &context) {
+                context.state.combatants[getSide(effect, context)].afraid = true;
+                return true;
+            }
+
+            bool heal(Effect const &effect, EffectContext &context) {
+                int side = getSide(effect, context);
+                Combatant &combatant = context.state.combatants[side];
+                int healed = std::min(combatant.maxHp * effect.a / 100, combatant.maxHp - combatant.hp);
+                if(combatant.hp > 0 && healed > 0) {
+                    combatant.hp += healed;
+                    context.log.push_back({BattleLogType::HEAL, (std::uint8_t)side, (std::int16_t)healed, 0});
+                }
+                return true;
+            }
+
+            bool recoil(Effect const &effect, EffectContext &context) {
+                int side = getSide(effect, context);
+                Combatant &combatant = context.state.combatants[side];
+                int damage = std::min(std::max(1, context.damage * effect.a / 100), combatant.hp);
+                if(context.damage > 0 && damage > 0) {
+                    combatant.hp -= damage;
+                    context.log.push_back({BattleLogType::DAMAGE, (std::uint8_t)side, (std::int16_t)damage, 0});
+                }
+                return true;
+            }
+
+            bool multiHit(Effect const &effect, EffectContext &context) {
+                context.hits = effect.a + BattleEngine::roll(context.state, effect.b - effect.a + 1);
+                return true;
+            }
+
+            /*!
+             * \brief The registered effects.
+             * \details The handlers are indexed by operation, so applying an effect is only a call through the table.
+             */
+            struct Registry {
+                std::map<std::string, std::pair<EffectOp, EffectCompiler>> compilers;
+                EffectHandler handlers[EFFECT_MAX_OPS] = {};
+
+                Registry() {
+                    add("ChangeStatEffect", EffectOp::CHANGE_STAT, compileChangeStat, changeStat);
+                    add("StatusEffect", EffectOp::STATUS, compileStatus, inflictStatus);
+                    add("ConfuseEffect", EffectOp::CONFUSE, compileConfuse, confuse);
+                    add("FlinchEffect", EffectOp::FLINCH, compileFlinch, flinch);
+                    add("HealEffect", EffectOp::HEAL, compileHeal, heal);
+                    add("RecoilEffect", EffectOp::RECOIL, compileRecoil, recoil);
+                    add("MultiHitEffect", EffectOp::MULTI_HIT, compileMultiHit, multiHit);
+                }
+
+                void add(std::string const &type, EffectOp op, EffectCompiler compiler, EffectHandler handler) {
+                    if((int)op >= EFFECT_MAX_OPS) {
+                        throw UnexpectedValueException(std::to_string((int)op), "an operation smaller than " + std::to_string(EFFECT_MAX_OPS), true);
+                    }
+                    compilers[type] = {op, compiler};
+                    handlers[(int)op] = handler;
+                }
             };
-            auto change_method = stat_to_method[stat];
 
-            // TODO : Add dialog if stat is at its min/max
+            Registry &getRegistry() {
+                static Registry registry;
+                return registry;
+            }
+
+        } // namespace
 
-            Elements::TurnAction statMod;
-            newTurnAction(&statMod);
+        void registerEffect(std::string const &type, EffectOp op, EffectCompiler compiler, EffectHandler handler) {
+            getRegistry().add(type, op, compiler, handler);
+        }
 
-            if(target == Target::MOVEER) {
-                (attacker.*change_method)(coef); // diff_value = attacker.changeXXX(coef)
-                statMod.type = Elements::TurnActionType::ATK_STAT_MOD;
-            } else {
-                (defender.*change_method)(coef); // diff_value = defender.changeXXX(coef)
-                statMod.type = Elements::TurnActionType::DEF_STAT_MOD;
+        void EffectList::compile(EffectPhase phase, nlohmann::json const &data) {
+            if(data.is_array()) {
+                for(nlohmann::json const &effect : data) {
+                    compile(phase, effect);
+                }
+                return;
+            }
+            if(data.value("null", false)) {
+                return;
+            }
+            std::string type = data.at("type");
+            Registry const &registry = getRegistry();
+            auto found = registry.compilers.find(type);
+            if(found == registry.compilers.end()) {
+                throw UnexpectedValueException(type, "a registered move effect", false);
             }
-            statMod.statCoef = coef;
-            statMod.statMod = stat;
-            turnQueue.push(statMod);
+            Effect effect = found->second.second(data.value("data", nlohmann::json::object()));
+            effect.op = found->second.first;
+            effects.insert(effects.begin() + begins[(int)phase + 1], effect);
+            for(int i = (int)phase + 1; i < 4; i++) {
+                begins[i]++;
+            }
+        }
 
-            return 0;
+        bool EffectList::run(EffectPhase phase, EffectContext &context) const {
+            EffectHandler const *handlers = getRegistry().handlers;
+            for(Effect const &effect : get(phase)) {
+                if(effect.chance < 100 && BattleEngine::roll(context.state, 100) >= effect.chance) {
+                    continue;
+                }
+                if(!handlers[(int)effect.op](effect, context)) {
+                    return false;
+                }
+            }
+            return true;
         }
 
     } // namespace Moves
 
 } // namespace OpMon
-#pragma GCC diagnostic pop
@@ -8,47 +8,142 @@
 #ifndef SRCCPP_JLPPC_REGIMYS_OBJECTS_ATTAQUES_HPP_
 #define SRCCPP_JLPPC_REGIMYS_OBJECTS_ATTAQUES_HPP_
 
+#include <cstdint>
+#include <span>
+#include <string>
+#include <type_traits>
+#include <vector>
+
 #include "../../nlohmann/json.hpp"
-#include "Move.hpp"
+#include "BattleLog.hpp"
+
+/*!
+ * \brief The number of operations which can be registered with Moves::registerEffect.
+ */
+#define EFFECT_MAX_OPS 32
 
 namespace OpMon {
-class OpMon;
+
+    struct BattleState;
 
     /*!
-     * \brief Contains the MoveEffects used in the game.
+     * \brief Contains the effects of the moves.
+     * \details The effects are compiled when the moves are loaded (see Move::initMoves) into a list of Effect, which are small records made of an operation
+     * and its arguments. During a battle, the engine runs them with a table of handlers indexed by operation : applying an effect never allocates memory.
+     *
+     * To add an effect, add its operation to EffectOp, write its handler and the function creating it from json, and register them in Moves.cpp with registerEffect.
+     * The loader finds the effect with the name given to registerEffect, so it doesn't need to be changed.
      */
     namespace Moves {
+
+        /*!
+         * \brief The moment when an effect is applied during the use of a move.
+         */
+        enum class EffectPhase : std::uint8_t {
+            PRE, /*!< Before the calculation of the damages.*/
+            POST, /*!< After the calculation of the damages.*/
+            FAIL /*!< If the move fails.*/
+        };
+
+        /*!
+         * \brief The operations done by the effects.
+         * \details In the comments, `a` and `b` are the arguments of the Effect, and "the OpMon" is the user of the move or its target (see Effect::onUser).
+         */
+        enum class EffectOp : std::uint8_t {
+            CHANGE_STAT, /*!< Changes the stage of the stat `a` of the OpMon by `b`.*/
+            STATUS, /*!< Gives the Status `a` to the OpMon, if it doesn't have a status already.*/
+            CONFUSE, /*!< Confuses the OpMon.*/
+            FLINCH, /*!< Makes the OpMon afraid : it doesn't move this turn if it hasn't moved yet.*/
+            HEAL, /*!< Heals `a` percents of the maximum HP of the OpMon.*/
+            RECOIL, /*!< Inflicts to the OpMon `a` percents of the damages done by the move.*/
+            MULTI_HIT /*!< The move hits from `a` to `b` times. Only used before the damages.*/
+        };
+
+        /*!
+         * \brief An effect of a move, compiled from the data of the move.
+         */
+        struct Effect {
+            EffectOp op;
+            /*!
+             * \brief If `true`, the effect is applied to the user of the move, else to its target.
+             */
+            bool onUser;
+            /*!
+             * \brief The probability of applying the effect, in percents. The effects with a probability of 100 don't use the random generator of the battle.
+             */
+            std::uint8_t chance;
+            std::int16_t a;
+            std::int16_t b;
+        };
+
+        static_assert(std::is_trivially_copyable_v<Effect> && sizeof(Effect) <= 8, "The effects are stored in flat arrays.");
+
         /*!
-         * \brief A generic effet to change an OpMon's statistic.
+         * \brief The data shared by the effects of one use of a move.
          */
-        class ChangeStatEffect : public MoveEffect {
-        public:
+        struct EffectContext {
+            BattleState &state;
+            int user;
+            int target;
+            BattleLog &log;
             /*!
-             * \brief Sets the target for the effect.
+             * \brief The number of times the move hits, changed by EffectOp::MULTI_HIT.
              */
-            enum class Target : int { MOVEER = 0,/*!< The move user will receive the stat modification.*/
-                                      DEFENDER = 1 /*!< The attacked OpMon will receive the stat modification.*/};
+            int hits;
             /*!
-             * \param target The targeted OpMon.
-             * \param stat The stat to change.
-             * \param coef The coefficient of the modification to apply.
+             * \brief The total damages done by the move, read by EffectOp::RECOIL.
              */
-            ChangeStatEffect(Target target, Stats stat, int coef);
+            int damage;
+        };
+
+        /*!
+         * \brief Applies an effect.
+         * \returns `false` if the move has to stop.
+         */
+        using EffectHandler = bool (*)(Effect const &effect, EffectContext &context);
+        /*!
+         * \brief Creates an effect from the `data` object of its json.
+         */
+        using EffectCompiler = Effect (*)(nlohmann::json const &data);
+
+        /*!
+         * \brief Registers an effect, so it can be used in the json files of the moves.
+         * \param type The name of the effect in the json files.
+         * \param op The operation of the effect, which has to be smaller than EFFECT_MAX_OPS.
+         */
+        void registerEffect(std::string const &type, EffectOp op, EffectCompiler compiler, EffectHandler handler);
+
+        /*!
+         * \brief The compiled effects of a move.
+         * \details The effects of all the phases are stored in the same array, the ones of each phase together.
+         */
+        class EffectList {
+          public:
             /*!
-             * \brief Initialises the object from a json object.
-             * \param data The json object.
+             * \brief Compiles the effects of a phase and adds them to the list.
+             * \param data The json of an effect (an object with `type` and `data`, ignored if `null` is `true`), or an array of them.
+             * \throws Utils::UnexpectedValueException if the type of an effect hasn't been registered, or if one of its values is out of its range.
              */
-            ChangeStatEffect(nlohmann::json const &data);
+            void compile(EffectPhase phase, nlohmann::json const &data);
+
+            std::span<Effect const> get(EffectPhase phase) const {
+                return std::span<Effect const>(effects.data() + begins[(int)phase], effects.data() + begins[(int)phase + 1]);
+            }
+
             /*!
-             * \brief Applies the stat modification.
+             * \brief Applies the effects of a phase, in order.
+             * \returns `false` if an effect stops the move. The next effects are then not applied.
              */
-            int apply(Move &move, OpMon &attacker, OpMon &defender, std::queue<Elements::TurnAction> &turnQueue) override;
+            bool run(EffectPhase phase, EffectContext &context) const;
 
-        protected:
-            Target target;/*!<\brief The targeted OpMon.*/
-            Stats stat;/*!<\brief The stat to change.*/
-            int coef;/*!< \brief The coefficient of the modifications to apply.*/
+          private:
+            std::vector<Effect> effects;
+            /*!
+             * \brief The index of the first effect of each phase, followed by the size of the list.
+             */
+            std::uint8_t begins[4] = {};
         };
+
     } // namespace Moves
 } // namespace OpMon
 
@@ -251,1018 +251,29 @@ namespace OpMon {
         HP = (HP < 0) ? 0 : HP;
     }
 
-    //This is some annoying methods.
-
-    int OpMon::changeATK(int power) {
-        if(power < 0) {
-            for(int i = 0; i > power; i--) {
-                switch(atkChange) {
-                case -6:
-                    return -7;
-                case -5:
-
-                    statATK = round(statATK / 1.16);
-                    atkChange--;
-                    break;
-                case -4:
-
-                    statATK = round(statATK * 0.878788);
-                    atkChange--;
-                    break;
-                case -3:
-
-                    statATK = round(statATK * 0.825);
-                    atkChange--;
-                    break;
-                case -2:
-
-                    statATK = round(statATK / 1.25);
-                    atkChange--;
-                    break;
-                case -1:
-
-                    statATK = round(statATK / 1.34);
-                    atkChange--;
-                    break;
-                case 0:
-
-                    statATK = round(statATK * 0.67);
-                    atkChange--;
-                    break;
-                case 1:
-
-                    statATK = round(statATK / 1.5);
-                    atkChange--;
-                    break;
-                case 2:
-
-                    statATK = round(statATK * 0.75);
-                    atkChange--;
-                    break;
-                case 3:
-
-                    statATK = round(statATK / 1.25);
-                    atkChange--;
-                    break;
-                case 4:
-
-                    statATK = round(statATK / 1.2);
-                    atkChange--;
-                    break;
-                case 5:
-
-                    statATK = round(statATK / 1.1667);
-                    atkChange--;
-                    break;
-                case 6:
-
-                    statATK = round(statATK * 0.875);
-                    atkChange--;
-                    break;
-                default:
-                    break;
-                }
-            }
-        } else {
-            for(int i = 0; i > power; i--) {
-                switch(atkChange) {
-                case -6:
-
-                    statATK = round(statATK * 1.16);
-                    atkChange++;
-                    break;
-                case -5:
-
-                    statATK = round(statATK / 0.878788);
-                    atkChange++;
-                    break;
-                case -4:
-
-                    statATK = round(statATK / 0.825);
-                    atkChange++;
-                    break;
-                case -3:
-
-                    statATK = round(statATK * 1.25);
-                    atkChange++;
-                    break;
-                case -2:
-
-                    statATK = round(statATK * 1.34);
-                    atkChange++;
-                    break;
-                case -1:
-
-                    statATK = round(statATK / 0.67);
-                    atkChange++;
-                    break;
-                case 0:
-
-                    statATK = round(statATK * 1.5);
-                    atkChange++;
-                    break;
-                case 1:
-
-                    statATK = round(statATK / 0.75);
-                    atkChange++;
-                    break;
-                case 2:
-
-                    statATK = round(statATK * 1.25);
-                    atkChange++;
-                    break;
-                case 3:
-
-                    statATK = round(statATK * 1.2);
-                    atkChange++;
-                    break;
-                case 4:
-
-                    statATK = round(statATK * 1.1667);
-                    atkChange++;
-                    break;
-                case 5:
-
-                    statATK = round(statATK / 0.875);
-                    atkChange++;
-                    break;
-                case 6:
-                    return 7;
-                default:
-                    break;
-                }
-            }
-        }
-
-        return power;
-    }
-
-    int OpMon::changeACC(int power) {
-        if(power < 0) {
-            for(int i = 0; i > power; i--) {
-                switch(accChange) {
-                case -6:
-                    return -7;
-                case -5:
-
-                    statACC = round(statACC * 0.888);
-                    accChange--;
-                    break;
-                case -4:
-
-                    statACC = round(statACC / 1.144);
-                    accChange--;
-                    break;
-                case -3:
-
-                    statACC = round(statACC * 0.858);
-                    accChange--;
-                    break;
-                case -2:
-
-                    statACC = round(statACC / 1.2);
-                    accChange--;
-                    break;
-                case -1:
-
-                    statACC = round(statACC / 1.25);
-                    accChange--;
-                    break;
-                case 0:
-
-                    statACC = round(statACC * 0.75);
-                    accChange--;
-                    break;
-                case 1:
-
-                    statACC = round(statACC / 1.333);
-                    accChange--;
-                    break;
-                case 2:
-
-                    statACC = round(statACC * 0.799640);
-                    accChange--;
-                    break;
-                case 3:
-
-                    statACC = round(statACC * 0.8335);
-                    accChange--;
-                    break;
-                case 4:
-
-                    statACC = round(statACC / 1.1665);
-                    accChange--;
-                    break;
-                case 5:
-
-                    statACC = round(statACC * 0.8747657);
-                    accChange--;
-                    break;
-                case 6:
-
-                    statACC = round(statACC * 0.889);
-                    accChange--;
-                    break;
-                default:
-                    break;
-                }
-            }
-        } else {
-
-            for(int i = 0; i > power; i--) {
-                switch(accChange) {
-                case -6:
-
-                    statACC = round(statACC / 0.888);
-                    accChange++;
-                    break;
-                case -5:
-
-                    statACC = round(statACC * 1.144);
-                    accChange++;
-                    break;
-                case -4:
-
-                    statACC = round(statACC / 0.858);
-                    accChange++;
-                    break;
-                case -3:
-
-                    statACC = round(statACC * 1.2);
-                    accChange++;
-                    break;
-                case -2:
-
-                    statACC = round(statACC * 1.25);
-                    accChange++;
-                    break;
-                case -1:
-
-                    statACC = round(statACC / 0.75);
-                    accChange++;
-                    break;
-                case 0:
-
-                    statACC = round(statACC * 1.333);
-                    accChange++;
-                    break;
-                case 1:
-
-                    statACC = round(statACC / 0.799640);
-                    accChange++;
-                    break;
-                case 2:
-
-                    statACC = round(statACC / 0.8335);
-                    accChange++;
-                    break;
-                case 3:
-
-                    statACC = round(statACC * 1.1665);
-                    accChange++;
-                    break;
-                case 4:
-
-                    statACC = round(statACC / 0.8747657);
-                    accChange++;
-                    break;
-                case 5:
-
-                    statACC = round(statACC / 0.889);
-                    accChange++;
-                    break;
-                case 6:
-                    return 7;
-                default:
-                    break;
-                }
-            }
-        }
-
-        return power;
-    }
-
-    int OpMon::changeEVA(int power) {
-        if(power < 0) {
-            for(int i = 0; i > power; i--) {
-                switch(evaChange) {
-                case -6:
-                    return -7;
-                case -5:
-
-                    statEVA = round(statEVA / 1.16);
-                    evaChange--;
-                    break;
-                case -4:
-
-                    statEVA = round(statEVA * 0.878788);
-                    evaChange--;
-                    break;
-                case -3:
-
-                    statEVA = round(statEVA * 0.825);
-                    evaChange--;
-                    break;
-                case -2:
-
-                    statEVA = round(statEVA / 1.25);
-                    evaChange--;
-                    break;
-                case -1:
-
-                    statEVA = round(statEVA / 1.34);
-                    evaChange--;
-                    break;
-                case 0:
-
-                    statEVA = round(statEVA * 0.67);
-                    evaChange--;
-                    break;
-                case 1:
-
-                    statEVA = round(statEVA / 1.5);
-                    evaChange--;
-                    break;
-                case 2:
-
-                    statEVA = round(statEVA * 0.75);
-                    evaChange--;
-                    break;
-                case 3:
-
-                    statEVA = round(statEVA / 1.25);
-                    evaChange--;
-                    break;
-                case 4:
-
-                    statEVA = round(statEVA / 1.2);
-                    evaChange--;
-                    break;
-                case 5:
-
-                    statEVA = round(statEVA / 1.1667);
-                    evaChange--;
-                    break;
-                case 6:
-
-                    statEVA = round(statEVA * 0.875);
-                    evaChange--;
-                    break;
-                default:
-                    break;
-                }
-            }
-        } else {
-
-            for(int i = 0; i > power; i--) {
-                switch(evaChange) {
-                case -6:
-
-                    statEVA = round(statEVA * 1.16);
-                    evaChange++;
-                    break;
-                case -5:
-
-                    statEVA = round(statEVA / 0.878788);
-                    evaChange++;
-                    break;
-                case -4:
-
-                    statEVA = round(statEVA / 0.825);
-                    evaChange++;
-                    break;
-                case -3:
-
-                    statEVA = round(statEVA * 1.25);
-                    evaChange++;
-                    break;
-                case -2:
-
-                    statEVA = round(statEVA * 1.34);
-                    evaChange++;
-                    break;
-                case -1:
-
-                    statEVA = round(statEVA / 0.67);
-                    evaChange++;
-                    break;
-                case 0:
-
-                    statEVA = round(statEVA * 1.5);
-                    evaChange++;
-                    break;
-                case 1:
-
-                    statEVA = round(statEVA / 0.75);
-                    evaChange++;
-                    break;
-                case 2:
-
-                    statEVA = round(statEVA * 1.25);
-                    evaChange++;
-                    break;
-                case 3:
-
-                    statEVA = round(statEVA * 1.2);
-                    evaChange++;
-                    break;
-                case 4:
-
-                    statEVA = round(statEVA * 1.1667);
-                    evaChange++;
-                    break;
-                case 5:
-
-                    statEVA = round(statEVA / 0.875);
-                    evaChange++;
-                    break;
-                case 6:
-                    return 7;
-                default:
-                    break;
-                }
-            }
-        }
-
-        return power;
-    }
-
-    int OpMon::changeDEF(int power) {
-        if(power < 0) {
-            for(int i = 0; i > power; i--) {
-                switch(defChange) {
-                case -6:
-                    return -7;
-                case -5:
-
-                    statDEF = round(statDEF / 1.16);
-                    defChange--;
-                    break;
-                case -4:
-
-                    statDEF = round(statDEF * 0.878788);
-                    defChange--;
-                    break;
-                case -3:
-
-                    statDEF = round(statDEF * 0.825);
-                    defChange--;
-                    break;
-                case -2:
-
-                    statDEF = round(statDEF / 1.25);
-                    defChange--;
-                    break;
-                case -1:
-
-                    statDEF = round(statDEF / 1.34);
-                    defChange--;
-                    break;
-                case 0:
-
-                    statDEF = round(statDEF * 0.67);
-                    defChange--;
-                    break;
-                case 1:
-
-                    statDEF = round(statDEF / 1.5);
-                    defChange--;
-                    break;
-                case 2:
-
-                    statDEF = round(statDEF * 0.75);
-                    defChange--;
-                    break;
-                case 3:
-
-                    statDEF = round(statDEF / 1.25);
-                    defChange--;
-                    break;
-                case 4:
-
-                    statDEF = round(statDEF / 1.2);
-                    defChange--;
-                    break;
-                case 5:
-
-                    statDEF = round(statDEF / 1.1667);
-                    defChange--;
-                    break;
-                case 6:
-
-                    statDEF = round(statDEF * 0.875);
-                    defChange--;
-                    break;
-                default:
-                    break;
-                }
-            }
-        } else {
-
-            for(int i = 0; i > power; i--) {
-                switch(defChange) {
-                case -6:
-
-                    statDEF = round(statDEF * 1.16);
-                    defChange++;
-                    break;
-                case -5:
-
-                    statDEF = round(statDEF / 0.878788);
-                    defChange++;
-                    break;
-                case -4:
-
-                    statDEF = round(statDEF / 0.825);
-                    defChange++;
-                    break;
-                case -3:
-
-                    statDEF = round(statDEF * 1.25);
-                    defChange++;
-                    break;
-                case -2:
-
-                    statDEF = round(statDEF * 1.34);
-                    defChange++;
-                    break;
-                case -1:
-
-                    statDEF = round(statDEF / 0.67);
-                    defChange++;
-                    break;
-                case 0:
-
-                    statDEF = round(statDEF * 1.5);
-                    defChange++;
-                    break;
-                case 1:
-
-                    statDEF = round(statDEF / 0.75);
-                    defChange++;
-                    break;
-                case 2:
-
-                    statDEF = round(statDEF * 1.25);
-                    defChange++;
-                    break;
-                case 3:
-
-                    statDEF = round(statDEF * 1.2);
-                    defChange++;
-                    break;
-                case 4:
-
-                    statDEF = round(statDEF * 1.1667);
-                    defChange++;
-                    break;
-                case 5:
-
-                    statDEF = round(statDEF / 0.875);
-                    defChange++;
-                    break;
-                case 6:
-                    return 7;
-
-                default:
-                    break;
-                }
-            }
-        }
-        return power;
-    }
-
-    int OpMon::changeATKSPE(int power) {
-        if(power < 0) {
-            for(int i = 0; i > power; i--) {
-                switch(atkSpeChange) {
-                case -6:
-                    return -7;
-                case -5:
-
-                    statATKSPE = round(statATKSPE / 1.16);
-                    atkSpeChange--;
-                    break;
-                case -4:
-
-                    statATKSPE = round(statATKSPE * 0.878788);
-                    atkSpeChange--;
-                    break;
-                case -3:
-
-                    statATKSPE = round(statATKSPE * 0.825);
-                    atkSpeChange--;
-                    break;
-                case -2:
-
-                    statATKSPE = round(statATKSPE / 1.25);
-                    atkSpeChange--;
-                    break;
-                case -1:
-
-                    statATKSPE = round(statATKSPE / 1.34);
-                    atkSpeChange--;
-                    break;
-                case 0:
-
-                    statATKSPE = round(statATKSPE * 0.67);
-                    atkSpeChange--;
-                    break;
-                case 1:
-
-                    statATKSPE = round(statATKSPE / 1.5);
-                    atkSpeChange--;
-                    break;
-                case 2:
-
-                    statATKSPE = round(statATKSPE * 0.75);
-                    atkSpeChange--;
-                    break;
-                case 3:
-
-                    statATKSPE = round(statATKSPE / 1.25);
-                    atkSpeChange--;
-                    break;
-                case 4:
-
-                    statATKSPE = round(statATKSPE / 1.2);
-                    atkSpeChange--;
-                    break;
-                case 5:
-
-                    statATKSPE = round(statATKSPE / 1.1667);
-                    atkSpeChange--;
-                    break;
-                case 6:
-
-                    statATKSPE = round(statATKSPE * 0.875);
-                    atkSpeChange--;
-                    break;
-                default:
-                    break;
-                }
-            }
-        } else {
-
-            for(int i = 0; i > power; i--) {
-                switch(atkSpeChange) {
-                case -6:
-
-                    statATKSPE = round(statATKSPE * 1.16);
-                    atkSpeChange++;
-                    break;
-                case -5:
-
-                    statATKSPE = round(statATKSPE / 0.878788);
-                    atkSpeChange++;
-                    break;
-                case -4:
-
-                    statATKSPE = round(statATKSPE / 0.825);
-                    atkSpeChange++;
-                    break;
-                case -3:
-
-                    statATKSPE = round(statATKSPE * 1.25);
-                    atkSpeChange++;
-                    break;
-                case -2:
-
-                    statATKSPE = round(statATKSPE * 1.34);
-                    atkSpeChange++;
-                    break;
-                case -1:
-
-                    statATKSPE = round(statATKSPE / 0.67);
-                    atkSpeChange++;
-                    break;
-                case 0:
-
-                    statATKSPE = round(statATKSPE * 1.5);
-                    atkSpeChange++;
-                    break;
-                case 1:
-
-                    statATKSPE = round(statATKSPE / 0.75);
-                    atkSpeChange++;
-                    break;
-                case 2:
-
-                    statATKSPE = round(statATKSPE * 1.25);
-                    atkSpeChange++;
-                    break;
-                case 3:
-
-                    statATKSPE = round(statATKSPE * 1.2);
-                    atkSpeChange++;
-                    break;
-                case 4:
-
-                    statATKSPE = round(statATKSPE * 1.1667);
-                    atkSpeChange++;
-                    break;
-                case 5:
-
-                    statATKSPE = round(statATKSPE / 0.875);
-                    atkSpeChange++;
-                    break;
-                case 6:
-                    return 7;
-                default:
-                    break;
-                }
-            }
-        }
-        return power;
-    }
-
-    int OpMon::changeDEFSPE(int power) {
-        if(power < 0) {
-            for(int i = 0; i > power; i--) {
-                switch(defSpeChange) {
-                case -6:
-                    return -7;
-                case -5:
-
-                    statDEFSPE = round(statDEFSPE / 1.16);
-                    defSpeChange--;
-                    break;
-                case -4:
-
-                    statDEFSPE = round(statDEFSPE * 0.878788);
-                    defSpeChange--;
-                    break;
-                case -3:
-
-                    statDEFSPE = round(statDEFSPE * 0.825);
-                    defSpeChange--;
-                    break;
-                case -2:
-
-                    statDEFSPE = round(statDEFSPE / 1.25);
-                    defSpeChange--;
-                    break;
-                case -1:
-
-                    statDEFSPE = round(statDEFSPE / 1.34);
-                    defSpeChange--;
-                    break;
-                case 0:
-
-                    statDEFSPE = round(statDEFSPE * 0.67);
-                    defSpeChange--;
-                    break;
-                case 1:
-
-                    statDEFSPE = round(statDEFSPE / 1.5);
-                    defSpeChange--;
-                    break;
-                case 2:
-
-                    statDEFSPE = round(statDEFSPE * 0.75);
-                    defSpeChange--;
-                    break;
-                case 3:
-
-                    statDEFSPE = round(statDEFSPE / 1.25);
-                    defSpeChange--;
-                    break;
-                case 4:
-
-                    statDEFSPE = round(statDEFSPE / 1.2);
-                    defSpeChange--;
-                    break;
-                case 5:
-
-                    statDEFSPE = round(statDEFSPE / 1.1667);
-                    defSpeChange--;
-                    break;
-                case 6:
-
-                    statDEFSPE = round(statDEFSPE * 0.875);
-                    defSpeChange--;
-                    break;
-                default:
-                    break;
-                }
-            }
-        } else {
-
-            for(int i = 0; i > power; i--) {
-                switch(defSpeChange) {
-                case -6:
-
-                    statDEFSPE = round(statDEFSPE * 1.16);
-                    defSpeChange++;
-                    break;
-                case -5:
-
-                    statDEFSPE = round(statDEFSPE / 0.878788);
-                    defSpeChange++;
-                    break;
-                case -4:
-
-                    statDEFSPE = round(statDEFSPE / 0.825);
-                    defSpeChange++;
-                    break;
-                case -3:
-
-                    statDEFSPE = round(statDEFSPE * 1.25);
-                    defSpeChange++;
-                    break;
-                case -2:
-
-                    statDEFSPE = round(statDEFSPE * 1.34);
-                    defSpeChange++;
-                    break;
-                case -1:
-
-                    statDEFSPE = round(statDEFSPE / 0.67);
-                    defSpeChange++;
-                    break;
-                case 0:
-
-                    statDEFSPE = round(statDEFSPE * 1.5);
-                    defSpeChange++;
-                    break;
-                case 1:
-
-                    statDEFSPE = round(statDEFSPE / 0.75);
-                    defSpeChange++;
-                    break;
-                case 2:
-
-                    statDEFSPE = round(statDEFSPE * 1.25);
-                    defSpeChange++;
-                    break;
-                case 3:
-
-                    statDEFSPE = round(statDEFSPE * 1.2);
-                    defSpeChange++;
-                    break;
-                case 4:
-
-                    statDEFSPE = round(statDEFSPE * 1.1667);
-                    defSpeChange++;
-                    break;
-                case 5:
-
-                    statDEFSPE = round(statDEFSPE / 0.875);
-                    defSpeChange++;
-                    break;
-                case 6:
-                    return 7;
-                default:
-                    break;
-                }
-            }
-        }
-        return power;
-    }
-
-    int OpMon::changeSPE(int power) {
-        if(power < 0) {
-            for(int i = 0; i > power; i--) {
-                switch(speChange) {
-                case -6:
-                    return -7;
-                case -5:
-
-                    statSPE = round(statSPE / 1.16);
-
-                    speChange--;
-                    break;
-                case -4:
-
-                    statSPE = round(statSPE * 0.878788);
-                    speChange--;
-                    break;
-                case -3:
-
-                    statSPE = round(statSPE * 0.825);
-                    speChange--;
-                    break;
-                case -2:
-
-                    statSPE = round(statSPE / 1.25);
-                    speChange--;
-                    break;
-                case -1:
-
-                    statSPE = round(statSPE / 1.34);
-                    speChange--;
-                    break;
-                case 0:
-
-                    statSPE = round(statSPE * 0.67);
-                    speChange--;
-                    break;
-                case 1:
-
-                    statSPE = round(statSPE / 1.5);
-                    speChange--;
-                    break;
-                case 2:
-
-                    statSPE = round(statSPE * 0.75);
-                    speChange--;
-                    break;
-                case 3:
-
-                    statSPE = round(statSPE / 1.25);
-                    speChange--;
-                    break;
-                case 4:
-
-                    statSPE = round(statSPE / 1.2);
-                    speChange--;
-                    break;
-                case 5:
-
-                    statSPE = round(statSPE / 1.1667);
-                    speChange--;
-                    break;
-                case 6:
-
-                    statSPE = round(statSPE * 0.875);
-                    speChange--;
-                    break;
-                default:
-                    break;
-                }
-            }
-        } else {
-
-            for(int i = 0; i > power; i--) {
-                switch(speChange) {
-                case -6:
-
-                    statSPE = round(statSPE * 1.16);
-                    speChange++;
-                    break;
-                case -5:
-
-                    statSPE = round(statSPE / 0.878788);
-                    speChange++;
-                    break;
-                case -4:
-
-                    statSPE = round(statSPE / 0.825);
-                    speChange++;
-                    break;
-                case -3:
-
-                    statSPE = round(statSPE * 1.25);
-                    speChange++;
-                    break;
-                case -2:
-
-                    statSPE = round(statSPE * 1.34);
-                    speChange++;
-                    break;
-                case -1:
-
-                    statSPE = round(statSPE / 0.67);
-                    speChange++;
-                    break;
-                case 0:
-
-                    statSPE = round(statSPE * 1.5);
-                    speChange++;
-                    break;
-                case 1:
-
-                    statSPE = round(statSPE / 0.75);
-                    speChange++;
-                    break;
-                case 2:
-
-                    statSPE = round(statSPE * 1.25);
-                    speChange++;
-                    break;
-                case 3:
-
-                    statSPE = round(statSPE * 1.2);
-                    speChange++;
-                    break;
-                case 4:
-
-                    statSPE = round(statSPE * 1.1667);
-                    speChange++;
-                    break;
-                case 5:
-
-                    statSPE = round(statSPE / 0.875);
-                    speChange++;
-                    break;
-                case 6:
-                    return 7;
-                default:
-                    break;
-                }
-            }
+    int OpMon::getUnmodifiedStat(Stats stat) const {
+        switch(stat) {
+        case Stats::ATK:
+            return statATK;
+        case Stats::DEF:
+            return statDEF;
+        case Stats::ATKSPE:
+            return statATKSPE;
+        case Stats::DEFSPE:
+            return statDEFSPE;
+        case Stats::SPE:
+            return statSPE;
+        case Stats::HP:
+            return statHP;
+        case Stats::EVA:
+            return statEVA;
+        case Stats::ACC:
+            return statACC;
+        case Stats::NOTHING:
+            Utils::Log::oplog("[WARNING] - Incorrect value in a switch (OpMon::getUnmodifiedStat). Expected a stat, got Stats::NOTHING.");
+            break;
         }
-        return power;
+        return 0;
     }
 
     bool OpMon::setStatus(Status status) {
@@ -1271,20 +282,6 @@ namespace OpMon {
         } else if(status != Status::NOTHING) { //If the OpMon already has a special status
             return false;
         }
-        //Some status needs to edit the stats
-        if(status == Status::BURNING) {
-            changeATK(-1);
-            atkChange++;
-        } else if(status == Status::NOTHING && this->status == Status::BURNING) {
-            changeATK(1);
-            atkChange--;
-        } else if(status == Status::PARALYSED) {
-            changeSPE(-1);
-            speChange++;
-        } else if(status == Status::NOTHING && this->status == Status::PARALYSED) {
-            changeSPE(1);
-            speChange--;
-        }
         this->status = status;
         return true;
     }
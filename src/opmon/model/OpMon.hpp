@@ -56,17 +56,9 @@ namespace OpMon {
         int statSPE;
         //Other stats
         int statEVA;
-        float statACC;
+        int statACC;
         int statHP;
         int statLove;
-        //Variables indicating stats variation level (See changeSTAT methods (Ex : changeATK) )
-        int atkChange = 0;
-        int defChange = 0;
-        int defSpeChange = 0;
-        int atkSpeChange = 0;
-        int evaChange = 0;
-        int accChange = 0;
-        int speChange = 0;
         const Species *species;
         int level;
 
@@ -216,35 +208,10 @@ namespace OpMon {
         void attacked(int hpLost);
 
         /*!
-         * \brief Changes the STAT depending of the power given.
-         * \details It doesn't edit directly the variable, it lowers or increases (Depending of the sign of the paramter) by multiplicating it.
-         * \param power The power of the change (negative if the stat descreases, positif if it increases).
+         * \brief Returns a stat, indexed by Stats.
+         * \details The OpMon doesn't have modification stages : they only exist during a battle, in Combatant::stages.
          */
-        int changeATK(int power);
-        /*!
-         * \copydoc OpMon::changeATK
-         */
-        int changeACC(int power);
-        /*!
-         * \copydoc OpMon::changeATK
-         */
-        int changeEVA(int power);
-        /*!
-         * \copydoc OpMon::changeATK
-         */
-        int changeDEF(int power);
-        /*!
-         * \copydoc OpMon::changeATK
-         */
-        int changeATKSPE(int power);
-        /*!
-         * \copydoc OpMon::changeATK
-         */
-        int changeDEFSPE(int power);
-        /*!
-         * \copydoc OpMon::changeATK
-         */
-        int changeSPE(int power);
+        int getUnmodifiedStat(Stats stat) const;
 
         Status getStatus() {
             return status;
@@ -298,6 +265,13 @@ namespace OpMon {
             return moves;
         }
 
+        /*!
+         * \brief Returns the move in the given slot, without copying the list of the moves.
+         */
+        Move *getMove(int slot) const {
+            return moves[slot];
+        }
+
         int getStatEVA() const {
             return statEVA;
         }
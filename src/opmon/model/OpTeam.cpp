@@ -5,7 +5,15 @@
 */
 #include "OpTeam.hpp"
 
+#include <algorithm>
+#include <fstream>
+#include <vector>
+
+#include "src/nlohmann/json.hpp"
+#include "src/utils/exceptions.hpp"
+#include "src/utils/log.hpp"
 #include "src/opmon/model/Enums.hpp"
+#include "src/opmon/model/Move.hpp"
 #include "src/opmon/model/OpMon.hpp"
 
 namespace OpMon {
@@ -66,4 +74,37 @@ namespace OpMon {
         return opteam.size();
     }
 
+    void OpTeam::initTrainers(std::filesystem::directory_iterator dir, std::map<unsigned int, Species *> const &species, std::map<std::string, OpTeam *> &list) {
+        //The files are loaded in the order of their names, not in the order of the file system, so the OpMons draw their stats in the same order everywhere.
+        std::vector<std::filesystem::directory_entry> files(std::filesystem::begin(dir), std::filesystem::end(dir));
+        std::sort(files.begin(), files.end());
+        for(std::filesystem::directory_entry const &file : files) {
+            if(file.is_regular_file()) {
+                std::ifstream trainersFile(file.path());
+                if(!trainersFile) {
+                    throw Utils::LoadingException(file.path().string(), true);
+                }
+                nlohmann::json trainersJson;
+                trainersFile >> trainersJson;
+
+                for(auto itor = trainersJson.begin(); itor != trainersJson.end(); ++itor) {
+                    OpTeam *team = new OpTeam(itor->at("name"));
+                    for(auto opmonItor = itor->at("team").begin(); opmonItor != itor->at("team").end(); ++opmonItor) {
+                        team->addOpMon(new OpMon(opmonItor->at("nickname"),
+                                                 species.at(opmonItor->at("species")),
+                                                 opmonItor->at("level"),
+                                                 {Move::newMove(opmonItor->at("moves")[0]),
+                                                  Move::newMove(opmonItor->at("moves")[1]),
+                                                  Move::newMove(opmonItor->at("moves")[2]),
+                                                  Move::newMove(opmonItor->at("moves")[3])},
+                                                 opmonItor->at("nature")));
+                    }
+                    list.emplace(itor->at("name"), team);
+                    std::string strName = itor->at("name");
+                    Utils::Log::oplog("Loaded trainer " + strName);
+                }
+            }
+        }
+    }
+
 } // namespace OpMon
@@ -6,6 +6,10 @@
 #ifndef SRCCPP_JLPPC_REGIMYS_PLAYERCORE_EQUIPE_HPP_
 #define SRCCPP_JLPPC_REGIMYS_PLAYERCORE_EQUIPE_HPP_
 
+#include <filesystem>
+#include <map>
+#include <string>
+
 #include "OpMon.hpp"
 
 namespace OpMon {
@@ -60,6 +64,15 @@ namespace OpMon {
         int getSize() const;
         void save();
 
+        /*!
+         * \brief Loads the teams of the trainers of the json files of a directory.
+         * \details The moves are created from Move::moveList, which has to be loaded. The files are loaded in the order of their names.
+         * \param species The species of the OpMons, indexed by their Opdex number.
+         * \param list Filled with the new teams, indexed by the name of their trainer.
+         * \throws Utils::LoadingException if a file can't be opened.
+         */
+        static void initTrainers(std::filesystem::directory_iterator dir, std::map<unsigned int, Species *> const &species, std::map<std::string, OpTeam *> &list);
+
     private:
         /*!
          * \brief The array containing the team.
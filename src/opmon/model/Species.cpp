@@ -6,7 +6,14 @@
 */
 #include "Species.hpp"
 
+#include <fstream>
+
+#include "../../nlohmann/json.hpp"
+#include "../../utils/exceptions.hpp"
+#include "../../utils/log.hpp"
+#include "../../utils/i18n/Translator.hpp"
 #include "./Evolution.hpp"
+#include "./evolutions.hpp"
 #include "src/opmon/model/CurveExp.hpp"
 #include "src/opmon/model/Enums.hpp"
 
@@ -88,4 +95,54 @@ namespace OpMon {
         }
     }
 #pragma GCC diagnostic pop
+
+    void Species::initSpecies(std::filesystem::directory_iterator dir, std::map<unsigned int, Species *> &list) {
+        Utils::StringKeys &keys = Utils::I18n::Translator::getInstance().getStringKeys();
+        for(std::filesystem::directory_entry const &file : dir) {
+            if(file.is_regular_file()) {
+                std::ifstream opmonJsonFile(file.path());
+                if(!opmonJsonFile) {
+                    throw Utils::LoadingException(file.path().string(), true);
+                }
+                nlohmann::json opmonJson;
+                opmonJsonFile >> opmonJson;
+
+                for(auto itor = opmonJson.begin(); itor != opmonJson.end(); ++itor) {
+                    int opDexNumber = itor->at("opDex");
+                    std::string opDexNumberStr = std::to_string(opDexNumber);
+
+                    Evolution *evol = nullptr;
+                    if(itor->at("evolution").at("type") == "level") {
+                        evol = new E_Level(itor->at("evolution").at("species"), itor->at("evolution").at("level"));
+                    } else if(itor->at("evolution").at("type") == "no") {
+                        evol = nullptr;
+                    }
+                    std::vector<Stats> evs;
+                    for(unsigned int i = 0; i < itor->at("evs").size(); ++i) {
+                        evs.push_back(itor->at("evs")[i]);
+                    }
+
+                    list.emplace(opDexNumber, new Species(itor->at("atk"),
+                                                          itor->at("def"),
+                                                          itor->at("atkSpe"),
+                                                          itor->at("defSpe"),
+                                                          itor->at("spe"),
+                                                          itor->at("HP"),
+                                                          keys.getStd("opmon.name." + opDexNumberStr),
+                                                          itor->at("types")[0],
+                                                          itor->at("types")[1],
+                                                          evol,
+                                                          evs,
+                                                          itor->at("height"),
+                                                          itor->at("weight"),
+                                                          keys.getStd("opmon.desc." + opDexNumberStr),
+                                                          itor->at("expGiven"),
+                                                          itor->at("curve"),
+                                                          itor->at("captureRate"),
+                                                          opDexNumber));
+                    Utils::Log::oplog("Loaded OpMon n°" + opDexNumberStr + " : " + list[opDexNumber]->getName());
+                }
+            }
+        }
+    }
 } // namespace OpMon
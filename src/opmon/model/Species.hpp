@@ -10,7 +10,9 @@
 #ifndef ESPECE_HPP
 #define ESPECE_HPP
 
+#include <filesystem>
 #include <iostream>
+#include <map>
 #include <vector>
 #include <string>
 
@@ -76,6 +78,13 @@ class CurveExp;
          * \param opdexNumber The number of the Species in the OpDex.
          */
         Species(unsigned int atk, unsigned int def, unsigned int atkSpe, unsigned int defSpe, unsigned int spe, unsigned int hp, std::string name, Type type1, Type type2, Evolution *evolType, std::vector<Stats> evGiven, float height, float weight, std::string opdexEntry, unsigned int expGiven, int expMax, int captureRate, int opdexNumber);
+        /*!
+         * \brief Loads the species of the json files of a directory.
+         * \details The names and the descriptions are taken from the current language of the translator, which has to be set.
+         * \param list Filled with the new species, indexed by their Opdex number.
+         * \throws Utils::LoadingException if a file can't be opened.
+         */
+        static void initSpecies(std::filesystem::directory_iterator dir, std::map<unsigned int, Species *> &list);
         unsigned int getBaseAtk() const {
             return baseAtk;
         }
@@ -0,0 +1,72 @@
+/*!
+ * \file StatStages.hpp
+ * \author Cyrielle
+ * \copyright GNU GPL v3.0
+ */
+#pragma once
+
+#include <array>
+
+#include "Enums.hpp"
+
+/*!
+ * \brief The highest modification stage of a stat. The lowest one is `-STAT_MAX_STAGE`.
+ */
+#define STAT_MAX_STAGE 6
+
+namespace OpMon {
+
+    /*!
+     * \brief The multipliers applied to the stats by their modification stages.
+     * \details At the stage `s`, a stat is multiplied by `(base + s) / base` if `s` is positive, and by `base / (base - s)` otherwise. `base` is 3 for the accuracy
+     * and the evasion, and 2 for the other stats. The multiplier is applied to the unmodified stat each time the stat is read, so a change of stage is exact and can be undone.
+     */
+    namespace StatStages {
+
+        struct Multiplier {
+            int numerator;
+            int denominator;
+        };
+
+        using Table = std::array<Multiplier, 2 * STAT_MAX_STAGE + 1>;
+
+        constexpr Table makeTable(int base) {
+            Table table{};
+            for(int stage = -STAT_MAX_STAGE; stage <= STAT_MAX_STAGE; stage++) {
+                table[stage + STAT_MAX_STAGE] = (stage >= 0) ? Multiplier{base + stage, base} : Multiplier{base, base - stage};
+            }
+            return table;
+        }
+
+        /*!
+         * \brief The multipliers of the stats other than the accuracy and the evasion, indexed by `stage + STAT_MAX_STAGE`.
+         */
+        inline constexpr Table statTable = makeTable(2);
+        /*!
+         * \brief The multipliers of the accuracy and the evasion, indexed by `stage + STAT_MAX_STAGE`.
+         */
+        inline constexpr Table accuracyTable = makeTable(3);
+
+        /*!
+         * \brief Limits a stage to [-STAT_MAX_STAGE, STAT_MAX_STAGE].
+         */
+        constexpr int clamp(int stage) {
+            return (stage < -STAT_MAX_STAGE) ? -STAT_MAX_STAGE : ((stage > STAT_MAX_STAGE) ? STAT_MAX_STAGE : stage);
+        }
+
+        /*!
+         * \brief Returns a stat with its modification stage applied.
+         * \param value The unmodified stat.
+         * \param stage The stage, in [-STAT_MAX_STAGE, STAT_MAX_STAGE].
+         */
+        constexpr int apply(int value, Stats stat, int stage) {
+            Multiplier const &multiplier = ((stat == Stats::ACC || stat == Stats::EVA) ? accuracyTable : statTable)[stage + STAT_MAX_STAGE];
+            return value * multiplier.numerator / multiplier.denominator;
+        }
+
+        static_assert(apply(100, Stats::ATK, STAT_MAX_STAGE) == 400 && apply(100, Stats::ATK, -STAT_MAX_STAGE) == 25, "The stats are multiplied by 4 at most and divided by 4 at least.");
+        static_assert(apply(99, Stats::ACC, STAT_MAX_STAGE) == 297 && apply(99, Stats::ACC, -STAT_MAX_STAGE) == 33, "The accuracy is multiplied by 3 at most and divided by 3 at least.");
+
+    } // namespace StatStages
+
+} // namespace OpMon
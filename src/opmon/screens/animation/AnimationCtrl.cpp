@@ -5,7 +5,7 @@
 */
 #include "AnimationCtrl.hpp"
 
-#include <SFML/Graphics/RenderTexture.hpp>
+#include <SFML/Graphics/RenderTarget.hpp>
 #include <utility>
 
 #include "src/opmon/screens/animation/Animations.hpp"
@@ -14,7 +14,7 @@ namespace OpMon {
     AnimationCtrl::AnimationCtrl(std::unique_ptr<Animations::Animation> view)
         : view(std::move(view)) {}
 
-    GameStatus AnimationCtrl::update(sf::RenderTexture &frame) {
+    GameStatus AnimationCtrl::update(sf::RenderTarget &frame) {
         GameStatus status = view->update();
         frame.draw(*view);
         return status;
@@ -9,7 +9,7 @@
 #include "src/opmon/screens/base/AGameScreen.hpp"
 
 namespace sf {
-class RenderTexture;
+class RenderTarget;
 }  // namespace sf
 
 namespace OpMon {
@@ -26,6 +26,6 @@ namespace OpMon {
         AnimationCtrl(std::unique_ptr<Animations::Animation> view);
         ~AnimationCtrl() = default;
 
-        GameStatus update(sf::RenderTexture &frame) override;
+        GameStatus update(sf::RenderTarget &frame) override;
     };
 } // namespace OpMon
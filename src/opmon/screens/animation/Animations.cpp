@@ -7,11 +7,13 @@
 #include "Animations.hpp"
 
 #include <cstddef>
+#include <utility>
 #include <SFML/Graphics/Color.hpp>
 #include <SFML/Graphics/RenderTarget.hpp>
 
 #include "src/utils/ResourceLoader.hpp"
 #include "src/opmon/core/GameStatus.hpp"
+#include "src/opmon/view/ui/Window.hpp"
 
 namespace OpMon {
 
@@ -22,13 +24,14 @@ namespace OpMon {
         //Array used by "WinAnim"
         sf::Texture WinAnim::fen[6];
 
-        Animation::Animation(sf::Texture bgTxt, sf::Texture after)
-            : bgTxt(bgTxt)
-            , afterTx(after) {
+        Animation::Animation(Ui::Snapshot bgTxt)
+            : bgTxt(std::move(bgTxt)) {
+            bgSpr.setTexture(*this->bgTxt);
+            Ui::Window::fitToScreen(bgSpr);
         }
 
-        WinAnim::WinAnim(sf::Texture const& bgTxt, bool order)
-            : Animation(bgTxt)
+        WinAnim::WinAnim(Ui::Snapshot bgTxt, bool order)
+            : Animation(std::move(bgTxt))
             , order(order) {
             if(!winInit) {
                 winInit = true;
@@ -37,7 +40,6 @@ namespace OpMon {
         }
 
         GameStatus WinAnim::update(){
-            bgSpr.setTexture(bgTxt);
             anim.setTexture(fen[(order ? counter : (frames - counter))]);
             counter++;
             return (counter > frames) ? GameStatus::PREVIOUS_NLS : GameStatus::CONTINUE;
@@ -48,8 +50,8 @@ namespace OpMon {
             frame.draw(anim);
         }
 
-        WooshAnim::WooshAnim(sf::Texture const& before, sf::Texture const& after, WooshDir dir, int duration, bool outToIn)
-            : Animation(before, after)
+        WooshAnim::WooshAnim(Ui::Snapshot before, sf::Texture const& after, WooshDir dir, int duration, bool outToIn)
+            : Animation(std::move(before))
             , dir(dir)
             , duration(duration)
             , outToIn(outToIn) {
@@ -69,7 +71,6 @@ namespace OpMon {
             mvDir[(int)WooshDir::LEFT] = sf::Vector2f(-1, 0);
 
             this->bgSpr.setPosition(0, 0);
-            this->bgSpr.setTexture(before);
 
             this->anim.setTexture(after);
             this->anim.setPosition(initialPos[(int)dir]);
@@ -19,6 +19,7 @@
 
 #include "src/opmon/core/GameStatus.hpp"
 #include "src/utils/defines.hpp"
+#include "src/opmon/view/ui/Window.hpp"
 
 namespace sf {
 class RenderTarget;
@@ -45,22 +46,16 @@ namespace OpMon {
              */
             sf::Sprite bgSpr;
             /*!
-             * \brief The texture of the background.
+             * \brief The snapshot shown in the background.
              */
-            sf::Texture bgTxt;
-            /*!
-             * \brief The texture to show after the animation.
-             */
-            sf::Texture afterTx;
+            Ui::Snapshot bgTxt;
 
         public:
             /*!
              * \brief Constructs an animation.
-             * \param before The texture present before the animation.
-             * \param after The texture to show after the animation.
-             * \details For classic animations, "before" is enough. "after" is used for transitions.
+             * \param before The snapshot of the screen present before the animation.
              */
-            Animation(sf::Texture before, sf::Texture after = sf::Texture());
+            Animation(Ui::Snapshot before);
             virtual ~Animation() = default;
             virtual GameStatus update() = 0;
             /*!
@@ -91,7 +86,7 @@ namespace OpMon {
             static sf::Texture fen[6];
 
         public:
-            WinAnim(sf::Texture const& bgTxt, bool order);
+            WinAnim(Ui::Snapshot bgTxt, bool order);
             virtual GameStatus update() override;
             void draw(sf::RenderTarget& frame, sf::RenderStates state) const;
         };
@@ -139,13 +134,13 @@ namespace OpMon {
         public:
             /*!
              * \brief Constructs a WooshAnim.
-             * \param before The static texture, in the background. It won't move.
-             * \param after The mobile texture.
+             * \param before The static snapshot, in the background. It won't move.
+             * \param after The mobile texture. It is not copied and must stay alive until the end of the animation.
              * \param dir The direction of the movement.
              * \param duraction The duration of the movement, in frames.
              * \param outToIn The initial position of the mobile sprite.
              */
-            WooshAnim(sf::Texture const& before, sf::Texture const& after, WooshDir dir, int duration = 15, bool outToIn = true);
+            WooshAnim(Ui::Snapshot before, sf::Texture const& after, WooshDir dir, int duration = 15, bool outToIn = true);
 
             GameStatus update();
             void draw(sf::RenderTarget& frame, sf::RenderStates state) const;
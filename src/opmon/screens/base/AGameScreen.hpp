@@ -13,7 +13,7 @@
 #pragma once
 
 #include "../../core/GameStatus.hpp"
-#include <SFML/Graphics/RenderTexture.hpp>
+#include <SFML/Graphics/RenderTarget.hpp>
 #include <SFML/Window/Event.hpp>
 #include <memory>
 
@@ -28,6 +28,8 @@ namespace OpMon {
      *
      * In addition, suspend() and resume() are called when respectively the controller loose the focus (another
      * controller is added on top) and regain the focus.
+     *
+     * When a suspended screen is buried deep enough in the stack, the GameLoop calls release(), and then restore() right before resume() when the screen gets the focus back.
      */
     class AGameScreen {
     public:
@@ -44,24 +46,67 @@ namespace OpMon {
          *
          * This method is called once per frame.
          */
-        virtual GameStatus update(sf::RenderTexture &frame) = 0;
+        virtual GameStatus update(sf::RenderTarget &frame) = 0;
 
         virtual void suspend(){};
         virtual void resume(){};
 
+        /*!
+         * \brief Tells if the screen changes without any user input.
+         * \details If `false`, the GameLoop only updates and draws the screen when an event is received, and waits for events the rest of the time. Screens which only change in checkEvent(), like menus, should return `false`.
+         * \returns `true` by default.
+         */
+        virtual bool isAnimating() const { return true; }
+
         /*!
          * \brief Loads the next screen.
          * \details Method called by Gameloop when the status returned is GameStatus::NEXT. It loads the next screen in _next_gs
+         * If _next_gs is left empty, the screen stays on the top of the stack.
          */
         virtual void loadNextScreen(){};
 
         std::unique_ptr<AGameScreen> getNextGameScreen() { return std::move(_next_gs); };
 
+        /*!
+         * \brief Calls freeResources() if the resources of the screen are loaded.
+         */
+        void release() {
+            if(!released) {
+                freeResources();
+                released = true;
+            }
+        }
+        /*!
+         * \brief Calls reloadResources() if the resources of the screen have been released.
+         */
+        void restore() {
+            if(released) {
+                reloadResources();
+                released = false;
+            }
+        }
+
     protected:
+        /*!
+         * \brief Frees the resources which aren't needed while the screen is suspended.
+         * \details Textures, dialogs, vertex arrays... Anything that can be reloaded by reloadResources(). The resources shared with the screens above must be kept.
+         */
+        virtual void freeResources(){};
+        /*!
+         * \brief Reloads the resources freed by freeResources().
+         */
+        virtual void reloadResources(){};
+
         /*!
          * \brief The next screen, loaded after loadNextScreen has been called.
          */
         std::unique_ptr<AGameScreen> _next_gs;
+
+    private:
+        /*!
+         * \brief If `true`, freeResources() has been called and reloadResources() has not been called since.
+         */
+        bool released = false;
     };
 
 } // namespace OpMon
@@ -18,6 +18,7 @@
 #include <vector>
 
 #include "src/utils/StringKeys.hpp"
+#include "src/opmon/model/BattleEngine.hpp"
 #include "src/opmon/model/Move.hpp"
 #include "BattleData.hpp"
 #include "src/opmon/core/Player.hpp"
@@ -28,6 +29,7 @@
 #include "src/opmon/view/ui/Dialog.hpp"
 #include "src/opmon/view/ui/Elements.hpp"
 #include "src/opmon/view/ui/Jukebox.hpp"
+#include "src/opmon/view/ui/Window.hpp"
 #include "src/utils/CycleCounter.hpp"
 #include "src/utils/OpString.hpp"
 #include "src/utils/defines.hpp"
@@ -36,7 +38,7 @@ namespace OpMon {
 
     void Battle::draw(sf::RenderTarget& frame, sf::RenderStates states) const {
 
-        frame.setView(frame.getDefaultView());
+        frame.setView(Ui::Window::getBaseView());
 
         frame.draw(background);
         frame.draw(playerSpr);
@@ -109,7 +111,48 @@ namespace OpMon {
         defHp = def->getHP();
     }
 
-    GameStatus Battle::update(Elements::TurnData const &atkTurn, Elements::TurnData const &defTurn, std::queue<Elements::TurnAction> &actionQueue, bool *turnActivated, bool atkFirst) {
+    sf::String Battle::getDialog(Elements::TurnAction const &action, Elements::TurnData const &atkTurn, Elements::TurnData const &defTurn) {
+        Utils::StringKeys &keys = data.getGameDataPtr()->getStringKeys();
+        OpMon *opmon = (action.side == 0) ? atkTurn.opmon : defTurn.opmon;
+        std::vector<sf::String *> objects;
+        sf::String count;
+        switch(action.message) {
+        case Elements::BattleMessage::NONE:
+        case Elements::BattleMessage::ALMOST_NO_EFFECT:
+        case Elements::BattleMessage::NOT_VERY_EFFECTIVE:
+        case Elements::BattleMessage::VERY_EFFECTIVE:
+        case Elements::BattleMessage::SUPER_EFFECTIVE:
+            break;
+        case Elements::BattleMessage::MOVE:
+            objects = {opmon->getNicknamePtr(), opmon->getMove(action.value)->getNamePtr()};
+            break;
+        case Elements::BattleMessage::HITS:
+            count = std::to_string(action.value);
+            objects = {&count};
+            break;
+        default:
+            objects = {opmon->getNicknamePtr()};
+            break;
+        }
+        char const *key = Elements::getMessageKey(action.message);
+        char const *fallback = Elements::getMessageFallback(action.message);
+        if(fallback != nullptr && !keys.has(key)) {
+            //The message is not translated yet
+            sf::String text;
+            std::size_t object = 0;
+            for(char const *c = fallback; *c != '\0'; c++) {
+                if(*c == '~' && object < objects.size()) {
+                    text += *objects[object++];
+                } else {
+                    text += *c;
+                }
+            }
+            return text;
+        }
+        return Utils::OpString(keys, key, objects).getString(keys);
+    }
+
+    GameStatus Battle::update(BattleState const &state, Elements::TurnData const &atkTurn, Elements::TurnData const &defTurn, Utils::RingBuffer<Elements::TurnAction> const &actions, bool *turnActivated, bool atkFirst) {
 
         drawDialog = false;
         drawMainDialog = false;
@@ -151,9 +194,13 @@ namespace OpMon {
                 turns[1] = &atkTurn;
             }
 
-            if(!actionQueue.empty()) {
+            if(actionIndex < actions.getCount()) {
+                if(!actions.contains(actionIndex)) {
+                    Utils::Log::warn("Battle: Some actions of the turn have been overwritten before being shown. Skipping them.");
+                    actionIndex = actions.getCount() - actions.getCapacity();
+                }
                 /* Handles the actions which can happen on screen */
-                Elements::TurnAction &turnAct = actionQueue.front();
+                Elements::TurnAction const &turnAct = actions[actionIndex];
 
                 if(turnAct.type == Elements::TurnActionType::DIALOG) { //If a dialog must be printed
                     if(dialogOver) {                         //A new dialog is created
@@ -162,27 +209,27 @@ namespace OpMon {
                             dialog = nullptr;
                         }
                         dialogOver = false;
-                        sf::String dialogs = turnAct.dialog.getString(data.getGameDataPtr()->getStringKeys());
+                        sf::String dialogs = getDialog(turnAct, atkTurn, defTurn);
                         dialog = new Ui::Dialog(dialogs, data.getGameDataPtr());
                     } else { //Continuing an old dialog
                         dialog->updateTextAnimation();
                         if(dialog->isDialogOver()) { //If the dialog is over, go to the next action in the queue
-                            actionQueue.pop();
+                            actionIndex++;
                             dialogOver = true;
                         }
                     }
                 } else if(turnAct.type == Elements::TurnActionType::ATK_UPDATE_HBAR || turnAct.type == Elements::TurnActionType::DEF_UPDATE_HBAR) { //Updates the player's OpMon's healthbar.
                     data.getGameDataPtr()->getJukebox().playSound("hit");
                     auto &opmonHp = (turnAct.type == Elements::TurnActionType::ATK_UPDATE_HBAR) ? atkHp : defHp;
-                    opmonHp -= turnAct.hpLost;
+                    opmonHp -= turnAct.value;
                     opmonHp = (opmonHp < 0) ? 0 : opmonHp; //Don't drop below 0
-                    actionQueue.pop();
+                    actionIndex++;
                 } else if(turnAct.type == Elements::TurnActionType::ATK_STAT_MOD || turnAct.type == Elements::TurnActionType::DEF_STAT_MOD) { //When an OpMon's stat is modified
 
                     //Animation part
                     if(currentOpAnims == nullptr) {
                         currentOpAnims = new std::queue<Ui::Transformation>();
-                        currentOpAnims->push(Ui::Transformation(40, Ui::MovementData(), Ui::RotationData(), Ui::Transformation::newScaleData(Ui::FormulaMode::MULTIFUNCTIONS, Ui::FormulaMode::MULTIFUNCTIONS, (turnAct.statCoef > 0) ? std::vector<double>{2, 0.1, 2 * PI / 20, 0, 0, 0.9} : std::vector<double>{2, -0.1, 2 * PI / 20, 0, 0, 1.1}, (turnAct.statCoef <= 0) ? std::vector<double>{2, 0.1, 2 * PI / 20, 0, 0, 0.9} : std::vector<double>{2, -0.1, 2 * PI / 20, 0, 0, 1.1}, Ui::Transformation::spriteCenter(atk))));
+                        currentOpAnims->push(Ui::Transformation(40, Ui::MovementData(), Ui::RotationData(), Ui::Transformation::newScaleData(Ui::FormulaMode::MULTIFUNCTIONS, Ui::FormulaMode::MULTIFUNCTIONS, (turnAct.extra > 0) ? std::vector<double>{2, 0.1, 2 * PI / 20, 0, 0, 0.9} : std::vector<double>{2, -0.1, 2 * PI / 20, 0, 0, 1.1}, (turnAct.extra <= 0) ? std::vector<double>{2, 0.1, 2 * PI / 20, 0, 0, 0.9} : std::vector<double>{2, -0.1, 2 * PI / 20, 0, 0, 1.1}, Ui::Transformation::spriteCenter(atk))));
                     }
                     if(currentOpAnims->front().empty()) {
                         currentOpAnims->front().attach((turnAct.type == Elements::TurnActionType::ATK_STAT_MOD) ? &atkTr : &defTr);
@@ -196,14 +243,14 @@ namespace OpMon {
                             dialog = nullptr;
                         }
                         dialogOver = false;
-                        dialog = new Ui::Dialog(Utils::OpString::quickString(data.getGameDataPtr()->getStringKeys(), "battle.stat." + std::to_string((int)turnAct.statMod) + "." + std::to_string(turnAct.statCoef), {opTurn.opmon->getNickname()}), data.getGameDataPtr());
+                        dialog = new Ui::Dialog(Utils::OpString::quickString(data.getGameDataPtr()->getStringKeys(), "battle.stat." + std::to_string(turnAct.value) + "." + std::to_string(turnAct.extra), {opTurn.opmon->getNickname()}), data.getGameDataPtr());
                     } else {
                         dialog->updateTextAnimation();
                     }
 
                     //Checking part
                     if(!currentOpAnims->front().apply() && dialog->isDialogOver()) { //If the dialog is over, go to the next action in the queue
-                        actionQueue.pop();
+                        actionIndex++;
                         dialogOver = true;
                         delete(currentOpAnims);
                         currentOpAnims = nullptr;
@@ -219,7 +266,7 @@ namespace OpMon {
                     } else {
                         dialog->updateTextAnimation();
                         if(dialog->isDialogOver()) {
-                            actionQueue.pop();
+                            actionIndex++;
                             delete(dialog);
                             dialog = nullptr;
                             return GameStatus::PREVIOUS;
@@ -236,7 +283,7 @@ namespace OpMon {
                     } else {
                         dialog->updateTextAnimation();
                         if(dialog->isDialogOver()) {
-                            actionQueue.pop();
+                            actionIndex++;
                             delete(dialog);
                             dialog = nullptr;
                             return GameStatus::PREVIOUS;
@@ -251,7 +298,7 @@ namespace OpMon {
                     }
                     if(!currentOpAnims->front().apply()) {
                         currentOpAnims->pop();
-                        actionQueue.pop();
+                        actionIndex++;
                         if(currentOpAnims->empty()) {
                             delete(currentOpAnims);
                             currentOpAnims = nullptr;
@@ -259,9 +306,9 @@ namespace OpMon {
                     }
                 } else if(turnAct.type == Elements::TurnActionType::NEXT) {
                     turnNber++;
-                    actionQueue.pop();
+                    actionIndex++;
                 } else {
-                    actionQueue.pop();
+                    actionIndex++;
                 }
             } else {
                 *turnActivated = false;
@@ -284,27 +331,30 @@ namespace OpMon {
 
         } else { //Moves menu
 
+            Combatant const &opmon = state.combatants[0];
             for(unsigned int i = 0; i < 4; i++) {
-                if(atkTurn.opmon->getMoves()[i] != nullptr) {
-                    moves[i].setString(atkTurn.opmon->getMoves()[i]->getName());
+                if(opmon.moves[i] != nullptr) {
+                    moves[i].setString(opmon.moves[i]->getName());
                 } else {
                     moves[i].setString("----"); //Text to print if there is no move
                 }
                 drawMoves = true;
             }
 
-            if(atkTurn.opmon->getMoves()[curPos.getValue()] != nullptr) {
+            Move const *move = opmon.moves[curPos.getValue()];
+            if(move != nullptr) {
+                int pp = opmon.pp[curPos.getValue()];
 
                 //Changes the text's color according to the number of PP left
-                if(atkTurn.opmon->getMoves()[curPos.getValue()]->getPP() <= (atkTurn.opmon->getMoves()[curPos.getValue()]->getPPMax() / 5) && atkTurn.opmon->getMoves()[curPos.getValue()]->getPP() > 0) {
+                if(pp <= (move->getPPMax() / 5) && pp > 0) {
                     ppTxt.setSfmlColor(sf::Color::Yellow);
-                } else if(atkTurn.opmon->getMoves()[curPos.getValue()]->getPP() == 0) {
+                } else if(pp == 0) {
                     ppTxt.setSfmlColor(sf::Color::Red);
                 } else {
                     ppTxt.setSfmlColor(sf::Color::Black);
                 }
-                ppTxt.setString(std::to_string(atkTurn.opmon->getMoves()[curPos.getValue()]->getPP()) + " / " + std::to_string(atkTurn.opmon->getMoves()[curPos.getValue()]->getPPMax()));
-                type.setTexture(data.getGameDataPtr()->getTypeTexture(atkTurn.opmon->getMoves()[curPos.getValue()]->getType()));
+                ppTxt.setString(std::to_string(pp) + " / " + std::to_string(move->getPPMax()));
+                type.setTexture(data.getGameDataPtr()->getTypeTexture(move->getType()));
                 drawType = true;
             } else { //If there is no move, print this
                 ppTxt.setSfmlColor(sf::Color::Red);
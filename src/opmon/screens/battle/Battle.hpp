@@ -9,6 +9,7 @@
 #include <SFML/Graphics/Transform.hpp>
 
 #include "src/utils/CycleCounter.hpp"
+#include "src/utils/RingBuffer.hpp"
 #include "src/opmon/view/elements/Turn.hpp"
 #include "BattleData.hpp"
 #include "src/opmon/view/ui/Dialog.hpp"
@@ -23,6 +24,7 @@ namespace OpMon {
 
     class OpTeam;
     class BattleData;
+    struct BattleState;
 class OpMon;
 namespace Ui {
 class Transformation;
@@ -34,7 +36,7 @@ class Transformation;
      *
      * The Battle view alternates between two phases :
      * - The choices phase, with the different menus where the player has to choose between different actions and moves. The view will only manage these two choices, the other selection menus (OpMon and items) will be manages by other views.
-     * - The turns phase, in which the actions are being executed. Everything is calculated in BattleCtrl and stored in a queue of TurnAction. This class reads these objects corresponding to the different animations this view has to do according to the TurnActionType object in them.
+     * - The turns phase, in which the actions are being executed. Everything is calculated in BattleCtrl and stored in a buffer of TurnAction. This class reads these objects corresponding to the different animations this view has to do according to the TurnActionType object in them.
      */
     class Battle : public sf::Drawable{
     private:
@@ -87,6 +89,11 @@ class Transformation;
          */
         int turnNber = 0;
 
+        /*!
+         * \brief The index of the next action to show in the buffer of BattleCtrl (see Utils::RingBuffer).
+         */
+        std::size_t actionIndex = 0;
+
         /*!
          * \brief If the turn has been launched and calculated in BattleCtrl.
          */
@@ -223,6 +230,11 @@ class Transformation;
          */
         bool drawType = false;
 
+        /*!
+         * \brief Makes the string of a TurnActionType::DIALOG action.
+         */
+        sf::String getDialog(Elements::TurnAction const &action, Elements::TurnData const &atk, Elements::TurnData const &def);
+
     public:
         /*!
          * \brief Initialises a battle.
@@ -238,14 +250,14 @@ class Transformation;
 
         /*!
          * \brief One frame of the battle.
-         * \param frame The frame of the game.
+         * \param state The state of the battle, giving the PP of the moves.
          * \param atk The player's turn data.
          * \param def The opponent's turn data.
-         * \param actionQueue A queue of the actions to do.
+         * \param actions The buffer of the actions to do. The actions are read from Battle::actionIndex, up to the last one pushed.
          * \param turnActivated A pointer to BattleCtrl::turnActivated. See Battle::phase for further explanation.
          * \param atkFirst If `true`, the player's turn is the first. Else, the opponent's turn is the first.
          */
-        GameStatus update(Elements::TurnData const &atk, Elements::TurnData const &def, std::queue<Elements::TurnAction> &actionQueue, bool *turnActivated, bool atkFirst);
+        GameStatus update(BattleState const &state, Elements::TurnData const &atk, Elements::TurnData const &def, Utils::RingBuffer<Elements::TurnAction> const &actions, bool *turnActivated, bool atkFirst);
 
         /*!
          * \brief Initializes the battle with the current data.
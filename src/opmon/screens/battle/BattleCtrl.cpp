@@ -6,34 +6,140 @@
 */
 #include "BattleCtrl.hpp"
 
-#include <SFML/Graphics/RenderTexture.hpp>
+#include <SFML/Graphics/RenderTarget.hpp>
 #include <SFML/System/String.hpp>
 #include <SFML/Window/Event.hpp>
 #include <SFML/Window/Keyboard.hpp>
 #include <algorithm>
+#include <cstdint>
+#include <ctime>
+#include <filesystem>
 #include <string>
+#include <vector>
 
-#include "src/utils/OpString.hpp"
 #include "src/opmon/core/GameData.hpp"
+#include "src/opmon/model/BattleEngine.hpp"
+#include "src/opmon/model/BattleLog.hpp"
+#include "src/opmon/model/BattleReplay.hpp"
 #include "src/opmon/model/Move.hpp"
 #include "src/opmon/model/Enums.hpp"
 #include "src/opmon/model/OpMon.hpp"
 #include "src/opmon/model/OpTeam.hpp"
+#include "src/opmon/core/system/path.hpp"
 #include "src/opmon/screens/battle/Battle.hpp"
 #include "src/opmon/screens/battle/BattleData.hpp"
 #include "src/opmon/view/elements/Turn.hpp"
 #include "src/opmon/view/ui/Jukebox.hpp"
+#include "src/utils/fs.hpp"
 #include "src/utils/misc.hpp"
 #include "src/opmon/view/elements/events/BattleEvent.hpp"
 
+/*!
+ * \brief The number of actions kept for the view, which has to be more than the actions of one turn.
+ */
+#define BATTLE_ACTIONS_SIZE 128
+/*!
+ * \brief The number of recorded battles kept in BattleCtrl::getReplayDirectory(). The oldest ones are removed.
+ */
+#define MAX_REPLAYS 20
+
 namespace OpMon {
 class Player;
 class Species;
 
+    namespace {
+        /*!
+         * \brief Creates a team with an OpMon of a replay.
+         * \param index The index of the OpMon in the replay, which is also its team.
+         */
+        OpTeam *makeReplayTeam(BattleReplay const &replay, int index, GameData *gamedata) {
+            //The view only shows battles between two OpMons
+            if(replay.getCount() != 2) {
+                throw Utils::UnexpectedValueException(std::to_string(replay.getCount()) + " OpMons", "a replay of a battle between two OpMons", false);
+            }
+            ReplayOpMon const &recorded = replay.getOpMon(index);
+            if(gamedata->getSpeciesList().count(recorded.species) == 0) {
+                throw Utils::UnexpectedValueException("species " + std::to_string(recorded.species), "a species of the game", false);
+            }
+            std::vector<Move *> moves;
+            for(std::string const &id : recorded.moves) {
+                moves.push_back(id.empty() ? nullptr : Move::newMove(id));
+                if(!id.empty() && moves.back() == nullptr) {
+                    for(Move *move : moves) {
+                        delete(move);
+                    }
+                    throw Utils::UnexpectedValueException(id, "a move of the game", false);
+                }
+            }
+            OpMon *opmon = new OpMon(recorded.nickname, gamedata->getOp(recorded.species), recorded.start.level, moves, Nature::QUIET);
+            //The stats can't be calculated again, as they depend on random values
+            for(Stats stat : {Stats::ATK, Stats::DEF, Stats::ATKSPE, Stats::DEFSPE, Stats::SPE, Stats::HP}) {
+                opmon->setStat(stat, recorded.start.stats[(int)stat]);
+            }
+            opmon->setType1(recorded.start.types[0]);
+            opmon->setType2(recorded.start.types[1]);
+            BattleEngine::applyCombatant(recorded.start, *opmon);
+
+            OpTeam *team = new OpTeam("replay");
+            team->addOpMon(opmon);
+            return team;
+        }
+    } // namespace
+
+    std::string BattleCtrl::getReplayDirectory() {
+        return Path::getSavePath() + "/replays";
+    }
+
+    std::string BattleCtrl::getLastReplayPath() {
+        //The names start with the date, so the last battle has the greatest name
+        std::string last;
+        std::error_code error;
+        for(std::filesystem::directory_entry const &file : std::filesystem::directory_iterator(getReplayDirectory(), error)) {
+            if(file.is_regular_file() && file.path().extension() == REPLAY_EXTENSION && file.path().string() > last) {
+                last = file.path().string();
+            }
+        }
+        return last;
+    }
+
+    std::string BattleCtrl::newReplayPath() {
+        std::time_t now = std::time(nullptr);
+        char date[32];
+        std::strftime(date, sizeof(date), "%Y%m%d-%H%M%S", std::localtime(&now));
+        //Several battles can end in the same second
+        for(int i = 0;; i++) {
+            std::string path = getReplayDirectory() + "/battle-" + date + (i < 10 ? "-0" : "-") + std::to_string(i) + REPLAY_EXTENSION;
+            if(!std::filesystem::exists(path)) {
+                return path;
+            }
+        }
+    }
+
+    void BattleCtrl::removeOldReplays() {
+        std::vector<std::filesystem::path> replays;
+        std::error_code error;
+        for(std::filesystem::directory_entry const &file : std::filesystem::directory_iterator(getReplayDirectory(), error)) {
+            if(file.is_regular_file() && file.path().extension() == REPLAY_EXTENSION) {
+                replays.push_back(file.path());
+            }
+        }
+        if(replays.size() <= MAX_REPLAYS) {
+            return;
+        }
+        //The names start with the date, so the oldest battles come first
+        std::sort(replays.begin(), replays.end());
+        for(std::size_t i = 0; i < replays.size() - MAX_REPLAYS; i++) {
+            if(!std::filesystem::remove(replays[i], error)) {
+                Utils::Log::warn("Battle: Can't remove the old replay " + replays[i].string() + ": " + error.message());
+            }
+        }
+    }
+
     BattleCtrl::BattleCtrl(OpTeam *one, Elements::BattleEvent *two, GameData *gamedata, Player *player)
         : BattleCtrl(one, two->getOpTeam(), gamedata, player) {
         this->trainer = two;
-        next.type = Elements::TurnActionType::NEXT;
+        ai.setLevel(two->getAILevel());
+        ai.setBudget(two->getAIBudget());
     }
 
     BattleCtrl::BattleCtrl(OpTeam *one, OpTeam *two, GameData *gamedata, Player *player)
@@ -42,18 +148,48 @@ class Species;
         , trainerTeam(two)
         , atk(one->getOp(0))
         , def(two->getOp(0))
-        , view(one, two, "beta", "grass", this->data) {
+        , view(one, two, "beta", "grass", this->data)
+        , actions(BATTLE_ACTIONS_SIZE) {
         initBattle(0, 0);
-        next.type = Elements::TurnActionType::NEXT;
     }
 
-    GameStatus BattleCtrl::update(sf::RenderTexture &frame) {
-        GameStatus returned = view.update(atkTurn, defTurn, actionsQueue, &turnActivated, atkFirst);
+    BattleCtrl::BattleCtrl(BattleReplay const &replay, GameData *gamedata, Player *player)
+        : BattleCtrl(makeReplayTeam(replay, 0, gamedata), makeReplayTeam(replay, 1, gamedata), gamedata, player) {
+        replayTeams[0].reset(playerTeam);
+        replayTeams[1].reset(trainerTeam);
+        this->replay = replay;
+        replaying = true;
+        OpMon *opmons[2] = {atk, def};
+        state = replay.getStartState(opmons);
+    }
+
+    GameStatus BattleCtrl::update(sf::RenderTarget &frame) {
+        if(replaying) {
+            if(!turnActivated) {
+                if(replayTurn >= replay.getTurnCount()) {
+                    //The replay stops before the end of the battle
+                    return GameStatus::PREVIOUS;
+                }
+                turn();
+                turnActivated = true;
+            }
+        } else if(!turnActivated && !ai.isThinking()) {
+            //The state doesn't change until the next turn, so the AI can search while the player chooses.
+            ai.think(state, 1);
+        }
+        GameStatus returned = view.update(state, atkTurn, defTurn, actions, &turnActivated, atkFirst);
         frame.draw(view);
         return returned;
     }
 
     GameStatus BattleCtrl::checkEvent(sf::Event const &event) {
+        if(replaying) {
+            //The choices are in the replay, the player can only pass the dialogs.
+            if(event.type == sf::Event::KeyPressed && (event.key.code == sf::Keyboard::Return || event.key.code == sf::Keyboard::Space)) {
+                view.passDialog();
+            }
+            return GameStatus::CONTINUE;
+        }
 
         switch(event.type) {
         case sf::Event::KeyPressed:
@@ -92,9 +228,10 @@ class Species;
 
                 } else if(!turnActivated) { //In this case, the move selection screen is the active screen.
                     //Gets the selected move, checks if it isn't a invalid move (PP check and existence check), and then launches the turn.
-                    atkTurn.moveUsed = atk->getMoves()[view.getCurPos()];
+                    atkTurn.moveSlot = view.getCurPos();
+                    atkTurn.moveUsed = atk->getMove(atkTurn.moveSlot);
                     if(atkTurn.moveUsed != nullptr) {
-                        if(atkTurn.moveUsed->getPP() > 0) {
+                        if(state.combatants[0].pp[view.getCurPos()] > 0) {
                             atkTurn.type = Elements::TurnType::MOVE;
                             turn();
                             view.toggleMoveChoice();
@@ -133,39 +270,12 @@ class Species;
     }
 
     void BattleCtrl::initBattle(int opId, int opId2) {
-        //Saves the OpMons' stats before the battle, to reset the stats after it.
         atk = playerTeam->getOp(opId);
         def = trainerTeam->getOp(opId2);
-        oldStats[0][0] = atk->getStatATK();
-        oldStats[0][1] = atk->getStatDEF();
-        oldStats[0][2] = atk->getStatATKSPE();
-        oldStats[0][3] = atk->getStatDEFSPE();
-        oldStats[0][4] = atk->getStatSPE();
-
-        oldStats[1][0] = def->getStatATK();
-        oldStats[1][1] = def->getStatDEF();
-        oldStats[1][2] = def->getStatATKSPE();
-        oldStats[1][3] = def->getStatDEFSPE();
-        oldStats[1][4] = def->getStatSPE();
-
-        oldTypes[0][0] = atk->getType1();
-        oldTypes[0][1] = atk->getType2();
-        oldTypes[1][0] = def->getType1();
-        oldTypes[1][1] = def->getType2();
-
-        const Species &atkSpecies = atk->getSpecies();
-        const Species &defSpecies = def->getSpecies();
-
-        oldSpecies[0] = &atkSpecies;
-        oldSpecies[1] = &defSpecies;
-
-        oldMoves[0] = atk->getMoves();
-        oldMoves[1] = def->getMoves();
-
-        atk->setStat(Stats::EVA, 100);
-        atk->setStat(Stats::ACC, 100);
-        def->setStat(Stats::EVA, 100);
-        def->setStat(Stats::ACC, 100);
+        state.count = 2;
+        state.combatants[0] = BattleEngine::makeCombatant(*atk, 0);
+        state.combatants[1] = BattleEngine::makeCombatant(*def, 1);
+        state.random = ((std::uint64_t)Utils::Misc::getRNGEngine()() << 32) | Utils::Misc::getRNGEngine()();
         //Clear the turns
         newTurnData(&atkTurn);
         newTurnData(&defTurn);
@@ -173,146 +283,170 @@ class Species;
         //Register the opmons' addresses in the Turns
         atkTurn.opmon = atk;
         defTurn.opmon = def;
+
+        OpMon *opmons[2] = {atk, def};
+        replay.start(state, opmons);
     }
 
-#pragma GCC diagnostic ignored "-Wunused-parameter"
-    //Unfinished method, the IA will be programmed in the future.
-    Elements::TurnData *BattleCtrl::turnIA(int level) {
-        defTurn.moveUsed = def->getMoves()[0];
-        defTurn.type = Elements::TurnType::MOVE;
+    Elements::TurnData *BattleCtrl::turnIA() {
+        BattleChoice choice = ai.getChoice(state, 1);
+        defTurn.moveSlot = choice.move;
+        defTurn.moveUsed = def->getMove(choice.move);
+        defTurn.type = choice.type;
         return &defTurn;
     }
-#pragma GCC diagnostic pop
-
-    bool BattleCtrl::checkBattleEnd() {
-        if(def->getHP() <= 0 || atk->getHP() <= 0) {
-        	trainer->setOver();
-            Elements::TurnAction batEnd;
-            batEnd.type = (def->getHP() <= 0) ? Elements::TurnActionType::VICTORY : Elements::TurnActionType::DEFEAT;
-            actionsQueue.push(batEnd);
-            return true;
-        }
-        return false;
-    }
 
     bool BattleCtrl::turn() {
-        //These variables are used to check if the turn of one of the OpMons' is over.
-        bool atkDone = false;
-        bool defDone = false;
-
-        turnIA(0);
-
-        if(!actionsQueue.empty()) {
-            Utils::Log::warn("Battle: Action queue not empty when beginning a new turn. Emptying it, hope it won't mess everything up. Good luck.");
-            actionsQueue = std::queue<Elements::TurnAction>();
-        }
-
-        //Item use or switching always comes before the move. It is calculated before everything else.
-        if(atkTurn.type != Elements::TurnType::MOVE) {
-            //Actions
-            atkDone = true;
-        }
-        if(defTurn.type != Elements::TurnType::MOVE) {
-            //Actions
-            defDone = true;
-        }
-        //If the two of them move, then the priority must be calculated. Else, the only attacking OpMon will move, obviously.
-        if(defTurn.type == Elements::TurnType::MOVE && atkTurn.type == Elements::TurnType::MOVE) {
-            atkFirst = (atkTurn.moveUsed->getPriority() == defTurn.moveUsed->getPriority()) ? (atk->getStatSPE() > def->getStatSPE()) : (atkTurn.moveUsed->getPriority() > defTurn.moveUsed->getPriority());
+        BattleChoice choices[2];
+        if(replaying) {
+            BattleChoice const *recorded = replay.getTurn(replayTurn++);
+            choices[0] = recorded[0];
+            choices[1] = recorded[1];
+            atkTurn.type = choices[0].type;
+            atkTurn.moveSlot = choices[0].move;
+            atkTurn.moveUsed = atk->getMove(choices[0].move);
+            defTurn.type = choices[1].type;
+            defTurn.moveSlot = choices[1].move;
+            defTurn.moveUsed = def->getMove(choices[1].move);
         } else {
-            atkFirst = !atkDone;
+            turnIA();
+            choices[0] = {atkTurn.type, atkTurn.moveSlot, 1};
+            choices[1] = {defTurn.type, defTurn.moveSlot, 0};
+            replay.addTurn(choices);
         }
 
-        if(!atkDone || !defDone) {
-            if(atkFirst) {
-                if(!atkDone && canMove(atk, &atkTurn)) {
-                    atkTurn.moveUsed->move(*atk, *def, actionsQueue, true);
-                }
-                actionsQueue.push(next);
-                if(!defDone && canMove(def, &defTurn) && !checkBattleEnd()) {
-                    defTurn.moveUsed->move(*def, *atk, actionsQueue, false);
-                }
-
-                checkBattleEnd();
+        int order[BATTLE_MAX_COMBATANTS];
+        BattleEngine::getOrder(state, choices, order);
+        atkFirst = order[0] == 0;
+        bool over = BattleEngine::resolveTurn(state, choices, log);
 
-            } else {
-                if(!defDone && canMove(def, &defTurn)) {
-                    defTurn.moveUsed->move(*def, *atk, actionsQueue, false);
-                }
-                actionsQueue.push(next);
-                if(!atkDone && canMove(atk, &atkTurn) && !checkBattleEnd()) {
-                    atkTurn.moveUsed->move(*atk, *def, actionsQueue, true);
+        if(log.size() > actions.getCapacity()) {
+            Utils::Log::warn("Battle: The turn has more actions than the buffer can keep. The first ones won't be shown.");
+        }
+        for(BattleLogEntry const &entry : log) {
+            showLogEntry(entry);
+        }
+        if(over) {
+            BattleEngine::applyCombatant(state.combatants[0], *atk);
+            BattleEngine::applyCombatant(state.combatants[1], *def);
+            if(trainer != nullptr) {
+                trainer->setOver();
+            }
+            if(!replaying) {
+                replay.end(state);
+                try {
+                    Utils::Fs::mkdir(getReplayDirectory());
+                    replay.save(newReplayPath());
+                } catch(Utils::Exception &e) {
+                    Utils::Log::warn("Battle: Can't record the battle: " + e.desc());
                 }
-                checkBattleEnd();
+                removeOldReplays();
             }
         }
 
         return false;
     }
 
-#pragma GCC diagnostic ignored "-Wunused-parameter"
-    bool BattleCtrl::canMove(OpMon *opmon, Elements::TurnData *opTurn) {
-        bool canMove = true;
-        std::vector<sf::String *> opName(1);
-        opName[0] = new sf::String(opmon->getNickname());
-        //Checks if frozen
-        if(opmon->getStatus() == Status::FROZEN) {
-            //The OpMon have one chance out of 5 to be able to move again.
-            if(Utils::Misc::randU(5) == 2) {
-                actionsQueue.push(Elements::createTurnDialogAction(Utils::OpString(data.getGameDataPtr()->getStringKeys(), "battle.status.frozen.out", opName)));
-                opmon->setStatus(Status::NOTHING);
-            } else {
-                actionsQueue.push(Elements::createTurnDialogAction(Utils::OpString(data.getGameDataPtr()->getStringKeys(), "battle.status.frozen.move", opName)));
-                canMove = false;
-            }
-            //Checks if sleeping
-        } else if(opmon->getStatus() == Status::SLEEPING) {
-            //Checks the sleep counter.
-            if(opmon->getSleepingCD() <= 0) {
-                actionsQueue.push(Elements::createTurnDialogAction(Utils::OpString(data.getGameDataPtr()->getStringKeys(), "battle.status.sleep.out", opName)));
-                opmon->setStatus(Status::NOTHING);
-            } else {
-                actionsQueue.push(Elements::createTurnDialogAction(Utils::OpString(data.getGameDataPtr()->getStringKeys(), "battle.status.sleep.move", opName)));
-                canMove = false;
-                opmon->passCD(true);
-            }
-            //Checks if paralysed
-        } else if(opmon->getStatus() == Status::PARALYSED) {
-            //The opmon have one chance out of three to can't move when paralysed
-            if(Utils::Misc::randU(4) == 2) {
-                actionsQueue.push(Elements::createTurnDialogAction(Utils::OpString(data.getGameDataPtr()->getStringKeys(), "battle.status.paralysed.move.fail", opName)));
-                canMove = false;
-            } else {
-                actionsQueue.push(Elements::createTurnDialogAction(Utils::OpString(data.getGameDataPtr()->getStringKeys(), "battle.status.paralysed.move.success", opName)));
-            }
-        }
-        //Checks if confused
-        if(opmon->confused) {
-            //Checks the confused counter
-            if(opmon->getConfusedCD() <= 0) {
-                opmon->confused = false;
-                actionsQueue.push(Elements::createTurnDialogAction(Utils::OpString(data.getGameDataPtr()->getStringKeys(), "battle.status.confused.out", opName)));
-            } else {
-                opmon->passCD(false);
-                //The OpMon have one chance out of two of failing their move.
-                if(Utils::Misc::randU(2) == 1) {
-                    actionsQueue.push(Elements::createTurnDialogAction(Utils::OpString(data.getGameDataPtr()->getStringKeys(), "battle.status.confused.move.fail", opName)));
-                    opmon->attacked(opmon->getStatHP() / 8);
-                } else {
-                    actionsQueue.push(Elements::createTurnDialogAction(Utils::OpString(data.getGameDataPtr()->getStringKeys(), "battle.status.confused.move.success", opName)));
-                }
-            }
-        }
-        //Checks if afraid
-        if(opmon->afraid) {
-            actionsQueue.push(Elements::createTurnDialogAction(Utils::OpString(data.getGameDataPtr()->getStringKeys(), "battle.status.afraid", opName)));
-            opmon->afraid = false;
-            canMove = false;
+    void BattleCtrl::showLogEntry(BattleLogEntry const &entry) {
+        auto dialog = [&](Elements::BattleMessage message) {
+            actions.push(Elements::createTurnDialogAction(message, entry.side));
+        };
+        Elements::TurnAction action;
+        Elements::newTurnAction(&action);
+        action.side = entry.side;
+
+        switch(entry.type) {
+        case BattleLogType::MOVE:
+            actions.push(Elements::createTurnDialogAction(Elements::BattleMessage::MOVE, entry.side, entry.value));
+            break;
+        case BattleLogType::MISS:
+            dialog(Elements::BattleMessage::FAIL);
+            break;
+        case BattleLogType::NO_EFFECT:
+            dialog(Elements::BattleMessage::NO_EFFECT);
+            break;
+        case BattleLogType::ANIMATION:
+            action.type = (Elements::TurnActionType)entry.value;
+            actions.push(action);
+            break;
+        case BattleLogType::DAMAGE:
+            action.type = (entry.side == 0) ? Elements::TurnActionType::ATK_UPDATE_HBAR : Elements::TurnActionType::DEF_UPDATE_HBAR;
+            action.value = entry.value;
+            actions.push(action);
+            break;
+        case BattleLogType::EFFECTIVENESS:
+            //The effectiveness is multiplied by 4 in the log
+            if(entry.value == 1)
+                dialog(Elements::BattleMessage::ALMOST_NO_EFFECT);
+            else if(entry.value == 2)
+                dialog(Elements::BattleMessage::NOT_VERY_EFFECTIVE);
+            else if(entry.value == 8)
+                dialog(Elements::BattleMessage::VERY_EFFECTIVE);
+            else if(entry.value == 16)
+                dialog(Elements::BattleMessage::SUPER_EFFECTIVE);
+            break;
+        case BattleLogType::STAT_CHANGE:
+            action.type = (entry.side == 0) ? Elements::TurnActionType::ATK_STAT_MOD : Elements::TurnActionType::DEF_STAT_MOD;
+            action.value = entry.value;
+            action.extra = entry.extra;
+            actions.push(action);
+            break;
+        case BattleLogType::FROZEN_OUT:
+            dialog(Elements::BattleMessage::FROZEN_OUT);
+            break;
+        case BattleLogType::FROZEN:
+            dialog(Elements::BattleMessage::FROZEN);
+            break;
+        case BattleLogType::SLEEP_OUT:
+            dialog(Elements::BattleMessage::SLEEP_OUT);
+            break;
+        case BattleLogType::SLEEP:
+            dialog(Elements::BattleMessage::SLEEP);
+            break;
+        case BattleLogType::PARALYSED_FAIL:
+            dialog(Elements::BattleMessage::PARALYSED_FAIL);
+            break;
+        case BattleLogType::PARALYSED_SUCCESS:
+            dialog(Elements::BattleMessage::PARALYSED_SUCCESS);
+            break;
+        case BattleLogType::CONFUSED_OUT:
+            dialog(Elements::BattleMessage::CONFUSED_OUT);
+            break;
+        case BattleLogType::CONFUSED_FAIL:
+            dialog(Elements::BattleMessage::CONFUSED_FAIL);
+            break;
+        case BattleLogType::CONFUSED_SUCCESS:
+            dialog(Elements::BattleMessage::CONFUSED_SUCCESS);
+            break;
+        case BattleLogType::AFRAID:
+            dialog(Elements::BattleMessage::AFRAID);
+            break;
+        case BattleLogType::STATUS:
+            dialog((Elements::BattleMessage)((int)Elements::BattleMessage::STATUS_BURNING + entry.value));
+            break;
+        case BattleLogType::CONFUSED:
+            dialog(Elements::BattleMessage::CONFUSED);
+            break;
+        case BattleLogType::HEAL:
+            //The health bars lose the value of the action, so the healed HP are negative
+            action.type = (entry.side == 0) ? Elements::TurnActionType::ATK_UPDATE_HBAR : Elements::TurnActionType::DEF_UPDATE_HBAR;
+            action.value = -entry.value;
+            actions.push(action);
+            dialog(Elements::BattleMessage::HEALED);
+            break;
+        case BattleLogType::HITS:
+            actions.push(Elements::createTurnDialogAction(Elements::BattleMessage::HITS, entry.side, entry.value));
+            break;
+        case BattleLogType::NEXT:
+            action.type = Elements::TurnActionType::NEXT;
+            actions.push(action);
+            break;
+        case BattleLogType::END:
+            action.type = (entry.side == 0) ? Elements::TurnActionType::VICTORY : Elements::TurnActionType::DEFEAT;
+            actions.push(action);
+            break;
         }
-        delete(opName[0]);
-        return canMove;
     }
-#pragma GCC diagnostic pop
 
     void BattleCtrl::suspend() {
         data.getGameDataPtr()->getJukebox().pause();
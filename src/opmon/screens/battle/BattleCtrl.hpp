@@ -5,13 +5,17 @@
  */
 #pragma once
 
+#include "src/opmon/model/BattleAI.hpp"
+#include "src/opmon/model/BattleEngine.hpp"
+#include "src/opmon/model/BattleReplay.hpp"
 #include "src/opmon/model/Move.hpp"
 #include "Battle.hpp"
 #include "src/opmon/screens/base/AGameScreen.hpp"
+#include "src/utils/RingBuffer.hpp"
 
 namespace sf {
 class Event;
-class RenderTexture;
+class RenderTarget;
 }  // namespace sf
 
 namespace OpMon {
@@ -30,7 +34,9 @@ namespace Elements {
      *
      * A battle is called in Overworld by a TrainerEvent. This controller is then created to manage the battle. When a battle is over, TurnActionType::VICTORY or TurnActionType::DEFEAT is sent to the view, which then sends GameStatus::PREVIOUS to the Gameloop, returning in the Overworld.
      *
-     * Each turn is calculated by turn(), and then the data is stored in a queue of TurnAction objects to transmit the information to the view, which will then do the corresponding animations.
+     * The battle engine can resolve turns with more OpMons, but the screen only shows battles between two OpMons : the player's is the combatant 0 and the opponent's the combatant 1.
+     *
+     * Each turn is calculated by turn(), and then the data is stored in a buffer of TurnAction objects to transmit the information to the view, which will then do the corresponding animations.
      */
     class BattleCtrl : public AGameScreen {
     private:
@@ -51,45 +57,56 @@ namespace Elements {
         Battle view;
 
         /*!
-         * \brief The queue of actions done in the turn.
-         * \details These actions are then transmitted to the view (Battle) to animate the screen.
+         * \brief The state of the battle, on which the turns are resolved.
+         * \details The OpMons are only changed when the battle is over, so nothing has to be restored after the battle.
+         */
+        BattleState state;
+        /*!
+         * \brief The log of the last turn.
+         */
+        BattleLog log;
+        /*!
+         * \brief Chooses the actions of the opponent.
+         * \details The AI starts thinking as soon as the player can choose an action, in its own thread.
          */
-        std::queue<Elements::TurnAction> actionsQueue;
+        BattleAI ai;
 
         /*!
-         * \brief The data of the player's turn.
+         * \brief The record of the battle, or the battle replayed if BattleCtrl::replaying is `true`.
          */
-        Elements::TurnData atkTurn;
+        BattleReplay replay;
         /*!
-         * \brief The data of the opponent's turn.
+         * \brief If `true`, the choices are read from BattleCtrl::replay instead of being asked to the player and the AI.
          */
-        Elements::TurnData defTurn;
+        bool replaying = false;
         /*!
-         * \brief `true` if the player's OpMon moves first, `false` otherwise.
+         * \brief The next turn to replay.
          */
-        bool atkFirst;
+        std::size_t replayTurn = 0;
+        /*!
+         * \brief The teams created for the replay, owned by the controller.
+         */
+        std::unique_ptr<OpTeam> replayTeams[2];
 
-        //These variables are used to restore the OpMon's stats after the battle
         /*!
-         * \brief The stats of the currently fighting OpMons before entering the battle.
-         * \details These stats are used to reset the stats the battle.
+         * \brief The actions done in the turns.
+         * \details These actions are then transmitted to the view (Battle), which reads them in order to animate the screen. The buffer is allocated once, with the
+         * battle, so a turn doesn't allocate memory.
          */
-        int oldStats[2][5];
+        Utils::RingBuffer<Elements::TurnAction> actions;
+
         /*!
-         * \brief The types of the currently fighting OpMons before entering the battle.
-         * \details These types are used to reset the types after the battle.
+         * \brief The data of the player's turn.
          */
-        Type oldTypes[2][2];
+        Elements::TurnData atkTurn;
         /*!
-         * \brief The species of the currently fighting OpMons before entering the battle.
-         * \details These species are used to reset the species after the battle.
+         * \brief The data of the opponent's turn.
          */
-        const Species *oldSpecies[2];
+        Elements::TurnData defTurn;
         /*!
-         * \brief The moves of the currently fighting OpMons before entering the battle.
-         * \details These moves are used to reset the moves after the battle.
+         * \brief `true` if the player's OpMon moves first, `false` otherwise.
          */
-        std::vector<Move *> oldMoves[2];
+        bool atkFirst;
 
         /*!
          * \brief `true` if the battle is in the turns phase.
@@ -107,10 +124,19 @@ namespace Elements {
          */
         bool sameDef = false;
 
+        /*!
+         * \brief Returns a new path in BattleCtrl::getReplayDirectory() to record the battle, made of the date and a counter.
+         */
+        static std::string newReplayPath();
+        /*!
+         * \brief Removes the oldest replays of BattleCtrl::getReplayDirectory(), so only the last MAX_REPLAYS battles are kept.
+         */
+        static void removeOldReplays();
+
         /*!
          * \brief Calculates one turn.
          *
-         * This method calculates first who moves first, and then calculates the different actions and their consequences by calling the Move::move methods of the moves. This method takes in parameter a reference to the TurnAction queue, so the moves can fill it.
+         * The turn is resolved by BattleEngine::resolveTurn, and its log is then translated in TurnAction objects for the view.
          */
         bool turn();
         /*!
@@ -121,35 +147,19 @@ namespace Elements {
         void initBattle(int opId, int opId2);
 
         /*!
-         * \warning WIP
-         * \brief Makes the IA choosing the actions of the opponent.
-         * \details This methods currently chooses the first move.
-         * \param level The level of intelligence for the IA
+         * \brief Gets the action of the opponent chosen by BattleCtrl::ai.
          */
-        Elements::TurnData *turnIA(int level);
+        Elements::TurnData *turnIA();
 
         /*!
-         * \brief Checks if the OpMon can move.
-         * \param opmon The OpMon to check.
-         * \param opTurn The data of this turn.
-         */
-        bool canMove(OpMon *opmon, Elements::TurnData *opTurn);
-        /*!
-         * \brief Checks if the battle is over.
-         * \returns `true` if the battle is over, `false` otherwise.
-         * \details This method also adds a TurnActionType::VICTORY or TurnActionType::DEFEAT to the BattleCtrl::actionsQueue if the battle is over.
+         * \brief Adds the TurnAction objects showing an entry of the battle log to BattleCtrl::actions.
          */
-        bool checkBattleEnd();
+        void showLogEntry(BattleLogEntry const &entry);
 
         /*!
          * \brief The opposite trainer.
          */
-        Elements::BattleEvent *trainer;
-
-        /*!
-         * \brief A shortcut to a TurnActionType::NEXT
-         */
-        Elements::TurnAction next;
+        Elements::BattleEvent *trainer = nullptr;
 
     public:
         virtual ~BattleCtrl() = default;
@@ -169,8 +179,24 @@ namespace Elements {
          * \param player The Player object.
          */
         BattleCtrl(OpTeam *one, Elements::BattleEvent *two, GameData *gamedata, Player *player);
+        /*!
+         * \brief Replays a recorded battle.
+         * \details The OpMons are created from the replay, and the turns are played one after the other, the player only passing the dialogs.
+         * \param replay The battle to replay.
+         * \param gamedata The GameData object.
+         * \param player The Player object.
+         */
+        BattleCtrl(BattleReplay const &replay, GameData *gamedata, Player *player);
+        /*!
+         * \brief Returns the directory in which the battles are recorded, each one in its own file.
+         */
+        static std::string getReplayDirectory();
+        /*!
+         * \brief Returns the path of the file in which the last battle played is recorded, or an empty string if no battle has been recorded.
+         */
+        static std::string getLastReplayPath();
         GameStatus checkEvent(sf::Event const &) override;
-        GameStatus update(sf::RenderTexture &frame) override;
+        GameStatus update(sf::RenderTarget &frame) override;
 
         virtual void suspend() override;
         virtual void resume() override;
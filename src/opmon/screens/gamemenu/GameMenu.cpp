@@ -15,12 +15,14 @@
 #include "src/opmon/core/GameData.hpp"
 #include "src/opmon/screens/gamemenu/GameMenuData.hpp"
 #include "src/utils/defines.hpp"
+#include "src/opmon/view/ui/Window.hpp"
 
 namespace OpMon {
 
     GameMenu::GameMenu(GameMenuData &data)
         : data(data) {
         background.setTexture(data.getBackground());
+        Ui::Window::fitToScreen(background);
         menuBg.setTexture(data.getMenuTexture());
         for(size_t i = 0; i < 6; i++) {
             selections[i].setTexture(data.getSelectionTexture(i));
@@ -6,7 +6,7 @@ File under GNU GPL v3.0 license
 
 #include "GameMenuCtrl.hpp"
 
-#include <SFML/Graphics/RenderTexture.hpp>
+#include <SFML/Graphics/RenderTarget.hpp>
 #include <SFML/Window/Event.hpp>
 #include <SFML/Window/Keyboard.hpp>
 #include <memory>
@@ -80,7 +80,7 @@ namespace OpMon {
             return GameStatus::CONTINUE;
         }
 
-        GameStatus GameMenuCtrl::update(sf::RenderTexture &frame) {
+        GameStatus GameMenuCtrl::update(sf::RenderTarget &frame) {
             frame.draw(view);
             return GameStatus::CONTINUE;
         }
@@ -104,4 +104,12 @@ namespace OpMon {
         void GameMenuCtrl::resume() {
         }
 
+        void GameMenuCtrl::freeResources() {
+            data.freeResources();
+        }
+
+        void GameMenuCtrl::reloadResources() {
+            data.loadResources();
+        }
+
 } // namespace OpMon
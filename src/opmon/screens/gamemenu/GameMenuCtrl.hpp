@@ -11,7 +11,7 @@
 
 namespace sf {
 class Event;
-class RenderTexture;
+class RenderTarget;
 }  // namespace sf
 
 namespace OpMon {
@@ -46,11 +46,16 @@ class Player;
         GameMenuCtrl(GameMenuData &data, Player &player);
 
         GameStatus checkEvent(sf::Event const &event) override;
-        GameStatus update(sf::RenderTexture &frame) override;
+        GameStatus update(sf::RenderTarget &frame) override;
 
         void loadNextScreen() override;
         void suspend() override;
         void resume() override;
+        bool isAnimating() const override { return false; }
+
+    protected:
+        void freeResources() override;
+        void reloadResources() override;
     };
 
 } // namespace OpMon
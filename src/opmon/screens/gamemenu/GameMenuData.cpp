@@ -16,8 +16,7 @@ class GameData;
     GameMenuData::GameMenuData(GameData *data, Player *player)
         : gamedata(data)
         , player(player) {
-        Utils::ResourceLoader::load(menuTexture, "backgrounds/menu.png");
-        Utils::ResourceLoader::loadTextureArray(selectionTexture, "backgrounds/menuS%d.png", 6, 1);
+        loadResources();
 
         selectionPos[0] = sf::Vector2f(106, 77);
         selectionPos[1] = sf::Vector2f(252, selectionPos[0].y);
@@ -27,4 +26,16 @@ class GameData;
         selectionPos[5] = sf::Vector2f(selectionPos[1].x, selectionPos[4].y);
     }
 
+    void GameMenuData::loadResources() {
+        Utils::ResourceLoader::load(menuTexture, "backgrounds/menu.png");
+        Utils::ResourceLoader::loadTextureArray(selectionTexture, "backgrounds/menuS%d.png", 6, 1);
+    }
+
+    void GameMenuData::freeResources() {
+        menuTexture = sf::Texture();
+        for(sf::Texture &texture : selectionTexture) {
+            texture = sf::Texture();
+        }
+    }
+
 } // namespace OpMon
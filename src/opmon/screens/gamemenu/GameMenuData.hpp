@@ -7,6 +7,7 @@
 
 #include "src/opmon/core/Player.hpp"
 #include "src/opmon/core/GameData.hpp"
+#include "src/opmon/view/ui/Window.hpp"
 
 namespace OpMon {
 class Player;
@@ -18,7 +19,7 @@ class GameData;
     class GameMenuData {
     private:
         sf::Texture menuTexture;
-        sf::Texture background;
+        Ui::Snapshot background;
 
         sf::Texture selectionTexture[6];
         sf::Vector2f selectionPos[6];
@@ -39,6 +40,16 @@ class GameData;
          */
         GameMenuData(GameData *data, Player *player);
 
+        /*!
+         * \brief Loads the textures of the menu.
+         */
+        void loadResources();
+        /*!
+         * \brief Frees the textures of the menu. The texture objects stay at the same address, so they can be reloaded with loadResources().
+         * \details The background snapshot is kept, it is shared with the screen below.
+         */
+        void freeResources();
+
         /*!
          * \brief Gets the background texture of the in-game menu.
          */
@@ -46,13 +57,13 @@ class GameData;
         /*!
          * \brief Gets the last saved background by GameMenuData::setBackground for the open/close animations.
          */
-        sf::Texture &getBackground() { return background; }
+        sf::Texture const &getBackground() { return *background; }
         /*!
-         * \brief Saves given texture, can be retreived with GameMenuData::getBackground.
-         * \details This method is made to be used for the open/close animations of the menu. The texture to be saved here should be the current screen before the menu opens.
-         * \param bg The texture to save.
+         * \brief Saves given snapshot, can be retreived with GameMenuData::getBackground.
+         * \details This method is made to be used for the open/close animations of the menu. The snapshot to be saved here should be the current screen before the menu opens.
+         * \param bg The snapshot to save. It is shared, not copied.
          */
-        void setBackground(sf::Texture const &bg) { background = bg; }
+        void setBackground(Ui::Snapshot bg) { background = std::move(bg); }
 
         /*!
          * \brief Gets the texture of a currently selected button.
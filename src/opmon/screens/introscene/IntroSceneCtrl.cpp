@@ -6,7 +6,7 @@
 */
 #include "IntroSceneCtrl.hpp"
 
-#include <SFML/Graphics/RenderTexture.hpp>
+#include <SFML/Graphics/RenderTarget.hpp>
 #include <SFML/System/String.hpp>
 #include <SFML/Window/Event.hpp>
 #include <SFML/Window/Keyboard.hpp>
@@ -22,6 +22,7 @@
 #include "IntroSceneData.hpp"
 #include "src/opmon/screens/base/AGameScreen.hpp"
 #include "src/opmon/view/ui/Dialog.hpp"
+#include "src/opmon/view/ui/Window.hpp"
 
 //Defines created to make the code easier to understand.
 #define LOAD_OVERWORLD 1
@@ -100,13 +101,13 @@ namespace OpMon {
         }
     }
 
-    GameStatus IntroSceneCtrl::update(sf::RenderTexture &frame) {
+    GameStatus IntroSceneCtrl::update(sf::RenderTarget &frame) {
         //If the player have finished to enter his/her name, animNext must have been set to true. This part will launch the animation.
         if(animNext) {
             animNext = false;
             frame.draw(view);
             loadNext = LOAD_ANIMATION_CLOSE;
-            screenTexture = frame.getTexture();
+            screenTexture = Ui::Window::snapshot(frame);
             return GameStatus::NEXT_NLS;
         }
         GameStatus toReturn = view.update();
@@ -118,7 +119,7 @@ namespace OpMon {
             switch(view.getPart()) {
             case 1:
                 loadNext = LOAD_ANIMATION_OPEN;
-                screenTexture = frame.getTexture();
+                screenTexture = Ui::Window::snapshot(frame);
                 toReturn = GameStatus::NEXT_NLS;
                 break;
             case 3:
@@ -140,4 +141,12 @@ namespace OpMon {
         view.play();
     }
 
+    void IntroSceneCtrl::freeResources() {
+        data.freeResources();
+    }
+
+    void IntroSceneCtrl::reloadResources() {
+        data.loadResources();
+    }
+
 } // namespace OpMon
@@ -11,10 +11,11 @@
 
 #include "IntroScene.hpp"
 #include "src/opmon/screens/base/AGameScreen.hpp"
+#include "src/opmon/view/ui/Window.hpp"
 
 namespace sf {
 class Event;
-class RenderTexture;
+class RenderTarget;
 }  // namespace sf
 
 namespace OpMon {
@@ -47,18 +48,22 @@ class GameData;
 
         /*!
          * \brief A screenshot.
-         * \details A screenshot of the frame is taken in update(sf::RenderTexture&). It is used as a background for the opening and closing animations before and after the input part of the introduction.
+         * \details A screenshot of the frame is taken in update(sf::RenderTarget&). It is used as a background for the opening and closing animations before and after the input part of the introduction.
          */
-        sf::Texture screenTexture;
+        Ui::Snapshot screenTexture;
 
     public:
         IntroSceneCtrl(GameData *data);
         GameStatus checkEvent(sf::Event const &event) override;
-        GameStatus update(sf::RenderTexture &frame) override;
+        GameStatus update(sf::RenderTarget &frame) override;
 
         void loadNextScreen() override;
         void suspend() override;
         void resume() override;
+
+    protected:
+        void freeResources() override;
+        void reloadResources() override;
     };
 
 } // namespace OpMon
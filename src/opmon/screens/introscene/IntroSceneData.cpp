@@ -19,13 +19,23 @@ class GameData;
     IntroSceneData::IntroSceneData(GameData *data)
         : gamedata(data)
         , player(new Player()) {
-        Utils::ResourceLoader::load(background, "backgrounds/start/introscene.png");
-        Utils::ResourceLoader::load(prof, "sprites/chara/prof/profkiwai.png");
-        Utils::ResourceLoader::load(nameBg, "backgrounds/start/nameEntry.png");
+        loadResources();
 
         //Player initalization
         player->setMapID("Player's room");
         player->getPosition().setDir(Side::TO_UP);
     }
 
+    void IntroSceneData::loadResources() {
+        Utils::ResourceLoader::load(background, "backgrounds/start/introscene.png");
+        Utils::ResourceLoader::load(prof, "sprites/chara/prof/profkiwai.png");
+        Utils::ResourceLoader::load(nameBg, "backgrounds/start/nameEntry.png");
+    }
+
+    void IntroSceneData::freeResources() {
+        background = sf::Texture();
+        prof = sf::Texture();
+        nameBg = sf::Texture();
+    }
+
 } // namespace OpMon
@@ -6,7 +6,7 @@
 */
 #include "MainMenuCtrl.hpp"
 
-#include <SFML/Graphics/RenderTexture.hpp>
+#include <SFML/Graphics/RenderTarget.hpp>
 #include <SFML/Window/Event.hpp>
 #include <SFML/Window/Keyboard.hpp>
 #include <memory>
@@ -69,7 +69,7 @@ namespace OpMon {
         return GameStatus::CONTINUE;
     }
 
-    GameStatus MainMenuCtrl::update(sf::RenderTexture &frame) {
+    GameStatus MainMenuCtrl::update(sf::RenderTarget &frame) {
         view.update(curPosI.getValue());
         frame.draw(view);
         return GameStatus::CONTINUE;
@@ -96,4 +96,12 @@ namespace OpMon {
         view.play();
     }
 
+    void MainMenuCtrl::freeResources() {
+        data.freeResources();
+    }
+
+    void MainMenuCtrl::reloadResources() {
+        data.loadResources();
+    }
+
 } // namespace OpMon
@@ -12,7 +12,7 @@
 
 namespace sf {
 class Event;
-class RenderTexture;
+class RenderTarget;
 }  // namespace sf
 
 namespace OpMon {
@@ -41,12 +41,17 @@ class GameData;
         MainMenuCtrl(GameData *data);
 
         GameStatus checkEvent(sf::Event const &event) override;
-        GameStatus update(sf::RenderTexture &frame) override;
+        GameStatus update(sf::RenderTarget &frame) override;
 
         void loadNextScreen() override;
 
         void suspend() override;
         void resume() override;
+        bool isAnimating() const override { return false; }
+
+    protected:
+        void freeResources() override;
+        void reloadResources() override;
     };
 
 } // namespace OpMon
@@ -12,6 +12,14 @@ class GameData;
 
     MainMenuData::MainMenuData(GameData *ptr)
         : gamedata(ptr) {
+        loadResources();
+    }
+
+    void MainMenuData::loadResources() {
         Utils::ResourceLoader::load(arrChoice, "sprites/misc/arrChoiceScale.png");
     }
+
+    void MainMenuData::freeResources() {
+        arrChoice = sf::Texture();
+    }
 } // namespace OpMon
@@ -42,5 +42,14 @@ class GameData;
          * \param ptr A pointer to the GameData object.
          */
         MainMenuData(GameData *ptr);
+
+        /*!
+         * \brief Loads the textures.
+         */
+        void loadResources();
+        /*!
+         * \brief Frees the textures. The texture objects stay at the same address, so they can be reloaded with loadResources().
+         */
+        void freeResources();
     };
 } // namespace OpMon
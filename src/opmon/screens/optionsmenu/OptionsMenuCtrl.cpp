@@ -7,7 +7,7 @@
 #include "OptionsMenuCtrl.hpp"
 
 #include <ext/alloc_traits.h>
-#include <SFML/Graphics/RenderTexture.hpp>
+#include <SFML/Graphics/RenderTarget.hpp>
 #include <SFML/Window/Event.hpp>
 #include <SFML/Window/Keyboard.hpp>
 #include <algorithm>
@@ -186,7 +186,15 @@ namespace OpMon {
         view.play();
     }
 
-    GameStatus OptionsMenuCtrl::update(sf::RenderTexture &frame) {
+    void OptionsMenuCtrl::freeResources() {
+        data.freeResources();
+    }
+
+    void OptionsMenuCtrl::reloadResources() {
+        data.loadResources();
+    }
+
+    GameStatus OptionsMenuCtrl::update(sf::RenderTarget &frame) {
         GameStatus status = view.update();
         frame.draw(view);
         return status;
@@ -17,7 +17,7 @@
 
 namespace sf {
 class Event;
-class RenderTexture;
+class RenderTarget;
 }  // namespace sf
 
 namespace OpMon {
@@ -44,7 +44,7 @@ class GameData;
     public:
         OptionsMenuCtrl(GameData *data);
         GameStatus checkEvent(sf::Event const &event) override;
-        GameStatus update(sf::RenderTexture &frame) override;
+        GameStatus update(sf::RenderTarget &frame) override;
 
         /*!
          * \brief The different names of the controls for the controls menu.
@@ -52,6 +52,11 @@ class GameData;
         const std::vector<std::string> controlsName{{"up", "down", "left", "right", "talk", "interact"}};
         void resume();
         void suspend();
+        bool isAnimating() const override { return false; }
+
+    protected:
+        void freeResources() override;
+        void reloadResources() override;
     };
 
 } // namespace OpMon
@@ -12,10 +12,22 @@ class GameData;
 
     OptionsMenuData::OptionsMenuData(GameData *data)
         : gamedata(data) {
+        loadResources();
+    }
+
+    void OptionsMenuData::loadResources() {
         Utils::ResourceLoader::load(selectBar, "sprites/misc/selectBar.png");
         Utils::ResourceLoader::load(creditsBg, "backgrounds/credits.png");
         Utils::ResourceLoader::load(controlsBg, "backgrounds/controls.png");
         Utils::ResourceLoader::load(volumeCur, "sprites/misc/cursor.png");
         Utils::ResourceLoader::load(keyChange, "sprites/misc/keyChange.png");
     }
+
+    void OptionsMenuData::freeResources() {
+        selectBar = sf::Texture();
+        creditsBg = sf::Texture();
+        controlsBg = sf::Texture();
+        volumeCur = sf::Texture();
+        keyChange = sf::Texture();
+    }
 } // namespace OpMon
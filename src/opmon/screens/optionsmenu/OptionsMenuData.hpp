@@ -67,5 +67,14 @@ class GameData;
          * \param ptr A pointer to the GameData object.
          */
         OptionsMenuData(GameData *data);
+
+        /*!
+         * \brief Loads the textures.
+         */
+        void loadResources();
+        /*!
+         * \brief Frees the textures. The texture objects stay at the same address, so they can be reloaded with loadResources().
+         */
+        void freeResources();
     };
 } // namespace OpMon
@@ -32,6 +32,12 @@
 #include "src/opmon/view/elements/Position.hpp"
 #include "src/opmon/view/ui/Elements.hpp"
 #include "src/opmon/view/ui/Jukebox.hpp"
+#include "src/opmon/view/ui/Window.hpp"
+
+/*!
+ * \brief The margin added around the camera to get the activity region, in pixels.
+ */
+#define ACTIVITY_MARGIN (4 SQUARES)
 
 namespace OpMon {
 
@@ -66,6 +72,14 @@ namespace OpMon {
         }
     }
 
+    sf::FloatRect Overworld::getActivityRegion() const {
+        const sf::Vector2f &cameraSize = camera.getSize();
+        return sf::FloatRect(camera.getCenter().x - cameraSize.x / 2.f - ACTIVITY_MARGIN,
+                             camera.getCenter().y - cameraSize.y / 2.f - ACTIVITY_MARGIN,
+                             cameraSize.x + 2 * ACTIVITY_MARGIN,
+                             cameraSize.y + 2 * ACTIVITY_MARGIN);
+    }
+
     void Overworld::updateCamera() {
         // Note: character is already center on itself:
         // character.getPosition() returns the center of the player's sprite
@@ -142,11 +156,28 @@ namespace OpMon {
         setMusic(current->getBg());
 
         //Recreates the layers
+        loadLayers();
+    }
+
+    void Overworld::loadLayers() {
         layer1 = std::make_unique<Ui::MapLayer>(current->getDimensions(), current->getLayer1(), data.getTileset(current->getTileset()));
         layer2 = std::make_unique<Ui::MapLayer>(current->getDimensions(), current->getLayer2(), data.getTileset(current->getTileset()));
         layer3 = std::make_unique<Ui::MapLayer>(current->getDimensions(), current->getLayer3(), data.getTileset(current->getTileset()));
     }
 
+    void Overworld::freeResources() {
+        layer1.reset();
+        layer2.reset();
+        layer3.reset();
+        if(isDialogOver()) {
+            dialog.reset();
+        }
+    }
+
+    void Overworld::reloadResources() {
+        loadLayers();
+    }
+
     void Overworld::pause() {
         data.getGameDataPtr()->getJukebox().pause();
     }
@@ -166,9 +197,7 @@ namespace OpMon {
         resetCamera();
 
         setMusic(current->getBg());
-        layer1 = std::make_unique<Ui::MapLayer>(current->getDimensions(), current->getLayer1(), data.getTileset(current->getTileset()));
-        layer2 = std::make_unique<Ui::MapLayer>(current->getDimensions(), current->getLayer2(), data.getTileset(current->getTileset()));
-        layer3 = std::make_unique<Ui::MapLayer>(current->getDimensions(), current->getLayer3(), data.getTileset(current->getTileset()));
+        loadLayers();
         character.setScale(2, 2);
         character.setOrigin(16, 16);
 
@@ -189,23 +218,14 @@ namespace OpMon {
         if((debugMode ? printlayer[1] : true)) {
             frame.draw(*layer2);
         }
+        const float playerY = data.getPlayer().getPosition().getPositionPixel().y;
         //Drawing events under the player
-        for(const Elements::AbstractEvent *event : current->getEvents()) {
-            const sf::Sprite *sprite = event->getSprite();
-            if(sprite->getPosition().y <= data.getPlayer().getPosition().getPositionPixel().y) {
-                frame.draw(*sprite);
-            }
-        }
+        current->getEventStore().draw(frame, playerY, false);
 
         frame.draw(character);
 
         //Drawing the events above the player
-        for(const Elements::AbstractEvent *event : current->getEvents()) {
-            const sf::Sprite *sprite = event->getSprite();
-            if(sprite->getPosition().y > data.getPlayer().getPosition().getPositionPixel().y) {
-                frame.draw(*sprite);
-            }
-        }
+        current->getEventStore().draw(frame, playerY, true);
 
         if(debugMode && printCollisions) {
             printCollisionLayer(frame);
@@ -219,7 +239,7 @@ namespace OpMon {
         printElements(frame);
 
         /***** draw GUI *****/
-        frame.setView(frame.getDefaultView());
+        frame.setView(Ui::Window::getBaseView());
 
 
         if(is_in_dialog) {
@@ -235,6 +255,10 @@ namespace OpMon {
 
     GameStatus Overworld::update() {
         bool is_in_dialog = this->dialog && !this->dialog->isDialogOver();
+        if(wasInDialog && !is_in_dialog) {
+            dialogEnd.notify();
+        }
+        wasInDialog = is_in_dialog;
 
         if(initPlayerAnimation) {
             startPlayerAnimationTime = Utils::Time::getElapsedMilliseconds();
@@ -282,11 +306,6 @@ namespace OpMon {
 
         updateCamera();
 
-        //Drawing events under the player
-        for(Elements::AbstractEvent *event : current->getEvents()) {
-            event->updateTexture();
-        }
-
         if(!is_in_dialog && data.getPlayer().getPosition().isAnim()) {
             if(data.getPlayer().getPosition().isMoving()) {
                 switch(data.getPlayer().getPosition().getDir()) {
@@ -332,11 +351,6 @@ namespace OpMon {
             character.setTextureRect(data.getTexturePPRect((unsigned int)data.getPlayer().getPosition().getDir()));
         }
 
-        //Drawing the events above the player
-        for(Elements::AbstractEvent *event : current->getEvents()) {
-            event->updateTexture();
-        }
-
         updateElements();
 
         return GameStatus::CONTINUE;
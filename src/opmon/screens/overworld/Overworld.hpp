@@ -13,6 +13,7 @@
 #include "src/opmon/view/ui/Dialog.hpp"
 #include "src/opmon/view/ui/Elements.hpp"
 #include "src/opmon/core/GameStatus.hpp"
+#include "src/opmon/core/Sequence.hpp"
 #include "src/opmon/view/elements/events/BattleEvent.hpp"
 
 namespace sf {
@@ -105,6 +106,16 @@ class TrainerEvent;
         virtual void play();
         virtual void pause();
 
+        /*!
+         * \brief Frees the layers of the map, and the dialog if it is over.
+         * \details The overworld must not be drawn until reloadResources() is called.
+         */
+        void freeResources();
+        /*!
+         * \brief Reloads the layers freed by freeResources().
+         */
+        void reloadResources();
+
         /*!
          * \brief Plays the music given in parameter.
          * \deprectated Directly use Jukebox::play.
@@ -164,6 +175,22 @@ class TrainerEvent;
 
         OverworldData &getData() { return data; }
 
+        /*!
+         * \brief Returns the scheduler running the sequences of the events.
+         */
+        SequenceScheduler &getSequences() { return sequences; }
+
+        /*!
+         * \brief Returns a signal notified each time a dialog ends.
+         */
+        Signal &getDialogEnd() { return dialogEnd; }
+
+        /*!
+         * \brief Returns the part of the map in which the events are fully updated, in pixels.
+         * \details This region is the area seen by the camera, extended by a margin so the events entering the screen are already active.
+         */
+        sf::FloatRect getActivityRegion() const;
+
         /*!
          * \brief If `true`, the game is in debug mode.
          */
@@ -197,6 +224,11 @@ class TrainerEvent;
          */
         void resetCamera();
 
+        /*!
+         * \brief Creates the layers of the current map.
+         */
+        void loadLayers();
+
         Elements::BattleEvent *trainerToBattle = nullptr;
 
         sf::Text debugText;
@@ -228,6 +260,13 @@ class TrainerEvent;
 
         bool cameraLock = false;
 
+        SequenceScheduler sequences;
+        Signal dialogEnd;
+        /*!
+         * \brief If a dialog was shown during the last update, to notify \ref dialogEnd when it ends.
+         */
+        bool wasInDialog = false;
+
         std::map<std::string, sf::Sprite> elementsSprites;
 
         OverworldData &data;
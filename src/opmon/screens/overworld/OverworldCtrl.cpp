@@ -6,13 +6,15 @@
  */
 #include "OverworldCtrl.hpp"
 
-#include <SFML/Graphics/RenderTexture.hpp>
+#include <SFML/Graphics/RenderTarget.hpp>
 #include <SFML/System/Vector2.hpp>
 #include <SFML/Window/Event.hpp>
 #include <SFML/Window/Keyboard.hpp>
+#include <algorithm>
 #include <memory>
 
 #include "src/opmon/screens/animation/AnimationCtrl.hpp"
+#include "src/opmon/model/BattleReplay.hpp"
 #include "src/opmon/screens/battle/BattleCtrl.hpp"
 #include "src/opmon/screens/gamemenu/GameMenuCtrl.hpp"
 #include "src/opmon/core/Player.hpp"
@@ -25,6 +27,7 @@
 #include "src/opmon/view/elements/Position.hpp"
 #include "src/opmon/view/ui/Dialog.hpp"
 #include "src/opmon/view/ui/Jukebox.hpp"
+#include "src/opmon/view/ui/Window.hpp"
 #include "src/opmon/core/GameStatus.hpp"
 
 //Defines created to make the code easier to read
@@ -32,6 +35,20 @@
 #define LOAD_MENU_OPEN 2
 #define LOAD_MENU 3
 #define LOAD_MENU_CLOSE 4
+#define LOAD_REPLAY 5
+
+/*!
+ * \brief The inactive events are updated once every INACTIVE_TICK_RATE frames.
+ */
+#define INACTIVE_TICK_RATE 8
+/*!
+ * \brief The size of the chunks of the map in which the events are prepared in parallel, in tiles.
+ */
+#define EVENTS_CHUNK_SIZE 16
+/*!
+ * \brief The number of events to update from which they are prepared in parallel. Under this number, starting the workers costs more than it saves.
+ */
+#define PARALLEL_EVENTS_THRESHOLD 1024
 
 namespace OpMon {
 
@@ -98,10 +115,15 @@ namespace OpMon {
 				if(events.key.code == sf::Keyboard::B) {
 					overworld.tp("Road 14", sf::Vector2i(10, 32));
 				}
+				//P replays the last battle
+				if(events.key.code == sf::Keyboard::P && !BattleCtrl::getLastReplayPath().empty()) {
+					loadNext = LOAD_REPLAY;
+					return GameStatus::NEXT;
+				}
 			}
 			if(events.key.code == sf::Keyboard::M) {
-				loadNext = LOAD_MENU_OPEN;
-				return GameStatus::NEXT_NLS;
+				//The menu opens after the next frame, which is kept as its background
+				menuRequested = true;
 			}
 		default:
 			break;
@@ -153,25 +175,43 @@ namespace OpMon {
 		return GameStatus::CONTINUE;
 	}
 
-	GameStatus OverworldCtrl::update(sf::RenderTexture &frame) {
+	GameStatus OverworldCtrl::update(sf::RenderTarget &frame) {
 		bool is_dialog_open = view.getDialog() && !view.getDialog()->isDialogOver();
+		frameCount++;
+		view.getSequences().tick();
 		if(!is_dialog_open) {
-			updateEvents(data.getMap(player.getMapId())->getEvents(), player, view);
+			Elements::Map *map = data.getMap(player.getMapId());
+			map->getPathfinder().moveTarget(Elements::Pathfinder::PLAYER_TARGET, player.getPosition().getPosition());
+			map->getPathfinder().update();
+			updateEvents(map->getEventStore(), player, view);
 		}
 
 		GameStatus toReturn = view.update();
 		frame.draw(view);
-		screenTexture = frame.getTexture();
+		if(menuRequested && toReturn == GameStatus::CONTINUE) {
+			menuRequested = false;
+			screenTexture = Ui::Window::snapshot(frame);
+			loadNext = LOAD_MENU_OPEN;
+			return GameStatus::NEXT_NLS;
+		}
 		return toReturn;
 	}
 
 	void OverworldCtrl::loadNextScreen() {
-		data.getGameMenuData().setBackground(screenTexture);
 		switch(loadNext) {
 		case LOAD_BATTLE:
 			_next_gs = std::make_unique<BattleCtrl>(data.getPlayer().getOpTeam(), view.getBattleDeclared(), data.getGameDataPtr(), data.getPlayerPtr());
 			break;
+		case LOAD_REPLAY:
+			//A broken replay mustn't close the game : no screen is loaded, and the player stays in the overworld
+			try {
+				_next_gs = std::make_unique<BattleCtrl>(BattleReplay::load(BattleCtrl::getLastReplayPath()), data.getGameDataPtr(), data.getPlayerPtr());
+			} catch(Utils::Exception &e) {
+				Utils::Log::warn("Overworld: Can't replay the last battle: " + e.desc());
+			}
+			break;
 		case LOAD_MENU_OPEN:
+			data.getGameMenuData().setBackground(screenTexture);
 			_next_gs = std::make_unique<AnimationCtrl>(std::make_unique<Animations::WooshAnim>(screenTexture, data.getGameMenuData().getMenuTexture(), Animations::WooshDir::UP, 15, true));
 			break;
 		case LOAD_MENU:
@@ -186,7 +226,7 @@ namespace OpMon {
 	}
 
 	void OverworldCtrl::suspend() {
-		if(loadNext == LOAD_BATTLE) {
+		if(loadNext == LOAD_BATTLE || loadNext == LOAD_REPLAY) {
 			data.getGameDataPtr()->getJukebox().pause();
 		}
 	}
@@ -195,6 +235,15 @@ namespace OpMon {
 		data.getGameDataPtr()->getJukebox().play(data.getCurrentMap()->getBg());
 	}
 
+	void OverworldCtrl::freeResources() {
+		//The game menu data is kept, it is used by the menu screens above.
+		view.freeResources();
+	}
+
+	void OverworldCtrl::reloadResources() {
+		view.reloadResources();
+	}
+
 	void OverworldCtrl::checkMove(Player &player, Overworld &overworld) {
 		if(!overworld.justTp && !player.getPosition().isAnim() && !player.getPosition().isLocked()) {
 			//TODO Factorise code
@@ -215,11 +264,21 @@ namespace OpMon {
 	}
 
 	void OverworldCtrl::move(Side direction, Player &player, Overworld &overworld) {
-		player.getPosition().move(direction, overworld.getData().getCurrentMap(), debugCol);
+		bool moved = player.getPosition().move(direction, overworld.getData().getCurrentMap(), debugCol);
 
-		Elements::Map *map = overworld.getData().getCurrentMap();
-		std::list<Elements::AbstractEvent*> eventList = map->getEvent(player.getPosition().getPosition());
-		actionEvents(eventList, player, Elements::EventTrigger::GO_IN, overworld);
+		actionEvents(player.getPosition().getPosition(), player, Elements::EventTrigger::GO_IN, overworld);
+		if(moved) {
+			checkSight(player.getPosition().getPosition(), player, overworld);
+		}
+	}
+
+	void OverworldCtrl::checkSight(sf::Vector2i const &tile, Player &player, Overworld &overworld) {
+		Elements::EventStore &events = overworld.getData().getCurrentMap()->getEventStore();
+		for(Elements::EventStore::Watcher const &watcher : events.getWatchers(tile)) {
+			if(events.getFacing()[watcher.slot] == watcher.dir) {
+				events.getEvent(watcher.slot)->seen(player, overworld);
+			}
+		}
 	}
 
 	void OverworldCtrl::checkAction(sf::Event const &event, Player &player, Overworld &overworld) {
@@ -246,65 +305,102 @@ namespace OpMon {
 					break;
 				}
 
-				std::list<Elements::AbstractEvent *> eventList = overworld.getData().getCurrentMap()->getEvent(sf::Vector2i(lx, ly));
-
-				//Checks if the event has been already triggered in the last frame.
-				//List of all elements present in eventList and already triggered in the last frame.
-				std::list<std::list<Elements::AbstractEvent *>::iterator> commonList;
-				for(std::list<Elements::AbstractEvent *>::iterator currentEvent = eventList.begin(); currentEvent != eventList.end(); ++currentEvent) {
-					bool alreadyUsed = false;
-					for(std::list<Elements::AbstractEvent*>::iterator usedEvent = usedList.begin(); usedEvent != usedList.end(); ++usedEvent) {
-						if(*usedEvent == *currentEvent) {
-							alreadyUsed = true;
-							commonList.push_back(currentEvent);
-						}
-					}
-				}
-				//Resets the used list with the current events
-				usedList = eventList;
-				//Deletes from eventList all events already triggered in the last frame.
-				for(std::list<Elements::AbstractEvent *>::iterator itor : commonList)
-					eventList.erase(itor);
-
-				actionEvents(eventList, player, Elements::EventTrigger::PRESS, overworld);
+				//The events already triggered in the last frame are ignored.
+				actionEvents(sf::Vector2i(lx, ly), player, Elements::EventTrigger::PRESS, overworld, true);
 			}
 		}
 
-		usedList.clear();
-
 		//Searches for events at the same position as the player and activates them if they are triggered when the playeris in them.
 		if(!player.getPosition().isMoving()) {
-			std::list<Elements::AbstractEvent *> eventList = overworld.getData().getCurrentMap()->getEvent(player.getPosition().getPosition());
-			actionEvents(eventList, player, Elements::EventTrigger::BE_IN, overworld);
+			actionEvents(player.getPosition().getPosition(), player, Elements::EventTrigger::BE_IN, overworld);
 		}
 	}
 
-	void OverworldCtrl::actionEvents(std::list<Elements::AbstractEvent *> &events, Player &player, Elements::EventTrigger toTrigger, Overworld &overworld) {
+	void OverworldCtrl::actionEvents(sf::Vector2i const &tile, Player &player, Elements::EventTrigger toTrigger, Overworld &overworld, bool once) {
 		//Checks if the player points at the right direction to activate the events. If yes, calls the events' action methods.
-		Side ppDir = player.getPosition().getDir();
-		for(std::list<Elements::AbstractEvent*>::iterator itor = events.begin(); itor != events.end(); ++itor) {
-			if((*itor)->getEventTrigger() == toTrigger) {
-				bool go = false;
-				if((((*itor)->getSide() & SIDE_UP) == SIDE_UP) && ppDir == Side::TO_UP) {
-					go = true;
-				} else if((((*itor)->getSide() & SIDE_DOWN) == SIDE_DOWN) && ppDir == Side::TO_DOWN) {
-					go = true;
-				} else if((((*itor)->getSide() & SIDE_RIGHT) == SIDE_RIGHT) && ppDir == Side::TO_RIGHT) {
-					go = true;
-				} else if((((*itor)->getSide() & SIDE_LEFT) == SIDE_LEFT) && ppDir == Side::TO_LEFT) {
-					go = true;
-				}
-				if(go) {
-					(*itor)->action(player, overworld);
+		int side;
+		switch(player.getPosition().getDir()) {
+		case Side::TO_UP:
+			side = SIDE_UP;
+			break;
+		case Side::TO_DOWN:
+			side = SIDE_DOWN;
+			break;
+		case Side::TO_RIGHT:
+			side = SIDE_RIGHT;
+			break;
+		case Side::TO_LEFT:
+			side = SIDE_LEFT;
+			break;
+		default:
+			return;
+		}
+
+		Elements::EventStore &events = overworld.getData().getCurrentMap()->getEventStore();
+		if(!events.hasTrigger(tile, toTrigger, side)) {
+			return;
+		}
+		const std::vector<sf::Vector2i> &tiles = events.getTiles();
+		for(std::size_t i = 0; i < tiles.size(); i++) {
+			if(tiles[i] == tile && events.getTriggers()[i] == toTrigger && (events.getSides()[i] & side) != 0) {
+				if(!events.stamp(i, frameCount) && once) {
+					continue;
 				}
+				events.getEvent(i)->action(player, overworld);
+			}
+		}
+	}
+
+	void OverworldCtrl::updateEvents(Elements::EventStore &events, Player &player, Overworld &overworld) {
+		sf::FloatRect region = overworld.getActivityRegion();
+		const std::vector<sf::Vector2i> &tiles = events.getTiles();
+		toUpdate.clear();
+		for(std::size_t i = 0; i < events.size(); i++) {
+			Elements::AbstractEvent *event = events.getEvent(i);
+			bool active = region.contains(tiles[i].x SQUARES, tiles[i].y SQUARES);
+			if(events.setActive(i, active)) {
+				event->wake();
+			}
+			//The slot is added to the counter to spread the updates of the inactive events over several frames.
+			if(active || (frameCount + i) % INACTIVE_TICK_RATE == 0 || !event->isOver()) {
+				toUpdate.push_back(i);
 			}
 		}
+
+		prepareEvents(events, *overworld.getData().getCurrentMap());
+
+		//The updates are done in the order of the slots : if two events want to go on the same tile, the first one reserves it and the other one is blocked.
+		for(std::size_t slot : toUpdate) {
+			events.getEvent(slot)->update(player, overworld);
+		}
 	}
 
-	void OverworldCtrl::updateEvents(std::vector<Elements::AbstractEvent *> &events, Player &player, Overworld &overworld) {
-		for(Elements::AbstractEvent *event : events) {
-			event->update(player, overworld);
+	void OverworldCtrl::prepareEvents(Elements::EventStore &events, Elements::Map const &map) {
+		if(toUpdate.size() < PARALLEL_EVENTS_THRESHOLD || workers.getWorkerCount() == 0) {
+			for(std::size_t slot : toUpdate) {
+				events.getEvent(slot)->prepare(map);
+			}
+			return;
 		}
+
+		//Sorts the events by chunk, so each thread reads the tiles of the same part of the map
+		sf::Vector2i chunksSize((map.getW() + EVENTS_CHUNK_SIZE - 1) / EVENTS_CHUNK_SIZE, (map.getH() + EVENTS_CHUNK_SIZE - 1) / EVENTS_CHUNK_SIZE);
+		chunks.resize(std::max(1, chunksSize.x * chunksSize.y));
+		for(std::vector<std::size_t> &chunk : chunks) {
+			chunk.clear();
+		}
+		const std::vector<sf::Vector2i> &tiles = events.getTiles();
+		for(std::size_t slot : toUpdate) {
+			int x = std::clamp(tiles[slot].x / EVENTS_CHUNK_SIZE, 0, std::max(0, chunksSize.x - 1));
+			int y = std::clamp(tiles[slot].y / EVENTS_CHUNK_SIZE, 0, std::max(0, chunksSize.y - 1));
+			chunks[x + y * chunksSize.x].push_back(slot);
+		}
+
+		workers.run(chunks.size(), [this, &events, &map](std::size_t chunk) {
+			for(std::size_t slot : chunks[chunk]) {
+				events.getEvent(slot)->prepare(map);
+			}
+		});
 	}
 
 } // namespace OpMon
@@ -9,11 +9,14 @@
 
 #include "Overworld.hpp"
 #include "src/opmon/screens/base/AGameScreen.hpp"
+#include "src/opmon/view/ui/Window.hpp"
+#include "src/utils/WorkerPool.hpp"
 #include <list>
+#include <vector>
 
 namespace sf {
 class Event;
-class RenderTexture;
+class RenderTarget;
 }  // namespace sf
 
 namespace OpMon {
@@ -48,9 +51,14 @@ class GameData;
 
         /*!
          * \brief Contains a screenshot.
-         * \details A screenshot of the frame is taken in update(sf::RenderTexture&). It used as a background in GameMenu and its opening/closing animations.
+         * \details A screenshot of the frame is taken in update(sf::RenderTarget&) when the menu is requested. It used as a background in GameMenu and its opening/closing animations.
          */
-        sf::Texture screenTexture;
+        Ui::Snapshot screenTexture;
+
+        /*!
+         * \brief If `true`, the menu key has been pressed. The next frame is drawn, kept in OverworldCtrl::screenTexture, and the menu opens.
+         */
+        bool menuRequested = false;
 
         /*!
          * \brief If `true`, the collision debug mode is activated (noclip).
@@ -58,11 +66,29 @@ class GameData;
         bool debugCol = false;
 
         /*!
-         * \brief List of last activated events by pressing a button.
-         *
-         * This list is used in checkAction to avoid AbstractEvent::action being called in two consecutive frames.
+         * \brief Counts the frames.
+         * \details Used to know when the inactive events have to be updated, and to avoid AbstractEvent::action being called in two consecutive frames (see EventStore::stamp).
+         */
+        unsigned int frameCount = 0;
+
+        /*!
+         * \brief The threads preparing the events.
+         */
+        Utils::WorkerPool workers;
+        /*!
+         * \brief The slots of the events updated in the current frame. Kept as a member to reuse its memory.
+         */
+        std::vector<std::size_t> toUpdate;
+        /*!
+         * \brief The slots of the events to prepare, sorted by chunk of the map. Kept as a member to reuse its memory.
          */
-        std::list<Elements::AbstractEvent*> usedList;
+        std::vector<std::vector<std::size_t>> chunks;
+
+        /*!
+         * \brief Calls AbstractEvent::prepare for the events in \ref toUpdate.
+         * \details If there are many events, the map is divided in chunks of EVENTS_CHUNK_SIZE tiles, which are prepared in parallel by \ref workers.
+         */
+        void prepareEvents(Elements::EventStore &events, Elements::Map const &map);
 
     public:
         OverworldCtrl(Player &player, GameData *gamedata);
@@ -76,7 +102,7 @@ class GameData;
          * \brief Checks the necessary events when no dialog is currently playing.
          */
         GameStatus checkEventsNoDialog(sf::Event const &events, Player &player);
-        GameStatus update(sf::RenderTexture &frame) override;
+        GameStatus update(sf::RenderTarget &frame) override;
 
         virtual void loadNextScreen();
         virtual void suspend();
@@ -94,28 +120,43 @@ class GameData;
          */
         void move(Side direction, Player &player, Overworld &overworld);
 
+        /*!
+         * \brief Calls AbstractEvent::seen for the events triggered with EventTrigger::ZONE which look at the given tile.
+         * \details The tiles seen by these events are precomputed by the EventStore (see EventStore::getWatchers).
+         * \param tile The tile the player has just moved in.
+         * \param player A reference to the player object.
+         * \param overworld A reference to the overworld view.
+         */
+        void checkSight(sf::Vector2i const &tile, Player &player, Overworld &overworld);
+
         /*!
          * \brief Calls Event::update for each event.
+         * \details The events outside of Overworld::getActivityRegion are inactive : they are only updated once every few frames, unless they are still processing an action.
+         * When an event becomes active again, AbstractEvent::wake is called before its update.
+         * The events are prepared first, in parallel (see prepareEvents) : they choose their movements and advance their animations. Then they are updated in the order of their slots :
+         * the first event moving on a tile reserves it, and the next ones are blocked. As the preparation doesn't depend on the other events, the result is the same as a serial update.
          * \param events The events.
          * \param player A reference to the player object.
          * \param overworld A reference to the overworld view.
          */
-        void updateEvents(std::vector<Elements::AbstractEvent *> &events, Player &player, Overworld &overworld);
+        void updateEvents(Elements::EventStore &events, Player &player, Overworld &overworld);
 
         /*!
-         * \brief Calls Event::action for some events.
+         * \brief Calls Event::action for the events of a tile.
          * \details The method checks two things first :
          * - If the EventTrigger of the event matches with the
          * given EventTrigger.
          * - If the side of interaction of the event matches with
          * the player's direction.
-         * \param events The events.
+         * If no event of the tile matches, the method returns after checking the tile's mask (see EventStore::hasTrigger).
+         * \param tile The tile containing the events.
          * \param player A reference to the player object.
          * \param toTrigger The method will only call
          * Event::action for the events with this EventTrigger.
          * \param overworld A reference to the overworld view.
+         * \param once If `true`, the events triggered in the previous frame are not triggered again.
          */
-        void actionEvents(std::list<Elements::AbstractEvent *> &events, Player &player, Elements::EventTrigger toTrigger, Overworld &overworld);
+        void actionEvents(sf::Vector2i const &tile, Player &player, Elements::EventTrigger toTrigger, Overworld &overworld, bool once = false);
 
         /*!
          * \brief Calls actionEvents for some events.
@@ -130,6 +171,10 @@ class GameData;
          * \param overworld A reference to the overworld view.
          */
         void checkAction(sf::Event const &event, Player &player, Overworld &overworld);
+
+    protected:
+        void freeResources() override;
+        void reloadResources() override;
     };
 
 } // namespace OpMon
@@ -112,30 +112,7 @@ namespace OpMon {
         	}
         }
 
-        for(std::filesystem::directory_entry const& file : std::filesystem::directory_iterator(Path::getResourcePath() + "data/trainers")) {
-        	if(file.is_regular_file()){
-        		std::ifstream trainersFile(file.path());
-        		nlohmann::json trainersJson;
-        		trainersFile >> trainersJson;
-
-        		for(auto itor = trainersJson.begin(); itor != trainersJson.end(); ++itor) {
-        			OpTeam *team = new OpTeam(itor->at("name"));
-        			for(auto opmonItor = itor->at("team").begin(); opmonItor != itor->at("team").end(); ++opmonItor) {
-        				team->addOpMon(new OpMon(opmonItor->at("nickname"),
-        						gamedata->getOp(opmonItor->at("species")),
-								opmonItor->at("level"),
-								{Move::newMove(opmonItor->at("moves")[0]),
-										Move::newMove(opmonItor->at("moves")[1]),
-										Move::newMove(opmonItor->at("moves")[2]),
-										Move::newMove(opmonItor->at("moves")[3])},
-										opmonItor->at("nature")));
-        			}
-        			trainers.emplace(itor->at("name"), team);
-        			std::string strName = itor->at("name");
-        			Utils::Log::oplog("Loaded trainer " + strName);
-        		}
-        	}
-        }
+        OpTeam::initTrainers(std::filesystem::directory_iterator(Path::getResourcePath() + "data/trainers"), gamedata->getSpeciesList(), trainers);
 
         completions.emplace("playername", player->getNameP());
 
@@ -171,6 +148,16 @@ namespace OpMon {
         return maps[map];
     }
 
+    std::size_t OverworldData::getFlagId(std::string const &name) {
+        auto itor = flagIds.find(name);
+        if(itor != flagIds.end()) {
+            return itor->second;
+        }
+        flags.push_back(0);
+        flagIds.emplace(name, flags.size() - 1);
+        return flags.size() - 1;
+    }
+
     Elements::Map *OverworldData::getCurrentMap() {
         return getMap(player->getMapId());
     }
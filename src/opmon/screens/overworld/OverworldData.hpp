@@ -55,6 +55,13 @@ class Map;
 
         std::map<std::string, sf::String *> completions;
 
+        /*!
+         * \brief The values of the flags used by the event scripts.
+         * \details A flag is identified by its index in this vector, given by getFlagId. The flags are not saved yet.
+         */
+        std::vector<int> flags;
+        std::map<std::string, std::size_t> flagIds;
+
         /*!
          * \brief Contains the tilesets.
          *
@@ -121,6 +128,15 @@ class Map;
          */
         OpTeam *getTrainer(std::string const &key) { return trainers.at(key); }
 
+        /*!
+         * \brief Gets the index of a flag, creating it with the value 0 if it doesn't exist.
+         */
+        std::size_t getFlagId(std::string const &name);
+        /*!
+         * \brief Gets the value of a flag from its index.
+         */
+        int &getFlag(std::size_t id) { return flags[id]; }
+
         /*!
          * \brief Gets a reference to the GameMenuData object.
          */
@@ -11,6 +11,10 @@ namespace OpMon {
 
     SaveMenu::SaveMenu(SaveMenuData &data)
       : data(data) {
+        loadResources();
+    }
+
+    void SaveMenu::loadResources() {
         float saveMenuItemX = (data.getGameDataPtr()->getWindowWidth() - SAVE_MENU_ITEM_WIDTH) / 2;
 
         sf::Vector2f hintTextBoxPosition(saveMenuItemX, SAVE_MENU_ITEM_PADDING);
@@ -48,6 +52,14 @@ namespace OpMon {
         noTextBox.setLeftContent("No");
     }
 
+    void SaveMenu::freeResources() {
+        hintTextBox = TextBox();
+        saveFilesTextBoxes.clear();
+        confirmationTextBox = TextBox();
+        yesTextBox = TextBox();
+        noTextBox = TextBox();
+    }
+
     void SaveMenu::onLangChanged() {
         // TODO: initialize strings for localization
     }
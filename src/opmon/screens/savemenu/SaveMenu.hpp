@@ -27,6 +27,16 @@ namespace OpMon {
 
         ~SaveMenu() = default;
 
+        /*!
+         * \brief Creates the text boxes of the menu.
+         */
+        void loadResources();
+
+        /*!
+         * \brief Destroys the text boxes, with their textures and vertex arrays. They can be created again with loadResources().
+         */
+        void freeResources();
+
         void onLangChanged() override;
 
         void draw(sf::RenderTarget &frame, sf::RenderStates states) const;
@@ -36,10 +36,18 @@ namespace OpMon {
         return GameStatus::CONTINUE;
     }
 
-    GameStatus SaveMenuCtrl::update(sf::RenderTexture &frame) {
+    GameStatus SaveMenuCtrl::update(sf::RenderTarget &frame) {
         GameStatus status = view.update();
         frame.draw(view);
         return status;
     }
 
+    void SaveMenuCtrl::freeResources() {
+        view.freeResources();
+    }
+
+    void SaveMenuCtrl::reloadResources() {
+        view.loadResources();
+    }
+
 } // namespace OpMon
@@ -5,7 +5,7 @@
 
 namespace sf {
     class Event;
-    class RenderTexture;
+    class RenderTarget;
 } // namespace sf
 
 namespace OpMon {
@@ -18,7 +18,12 @@ namespace OpMon {
 
         GameStatus checkEvent(sf::Event const &event) override;
 
-        GameStatus update(sf::RenderTexture &frame) override;
+        GameStatus update(sf::RenderTarget &frame) override;
+        bool isAnimating() const override { return false; }
+
+      protected:
+        void freeResources() override;
+        void reloadResources() override;
 
       private:
         SaveMenuData data;
@@ -0,0 +1,427 @@
+/*
+Tournament.cpp
+Author : Cyrielle
+File under GNU GPL v3.0 license
+*/
+#include "Tournament.hpp"
+
+#include <algorithm>
+#include <fstream>
+#include <iomanip>
+#include <map>
+#include <thread>
+#include <utility>
+
+#include "../../utils/exceptions.hpp"
+#include "../../utils/log.hpp"
+#include "../model/Move.hpp"
+
+namespace OpMon::Sim {
+
+    namespace {
+        /*!
+         * \brief Returns the next number of a SplitMix64 generator, as BattleEngine::roll does.
+         */
+        std::uint64_t mix(std::uint64_t &random) {
+            std::uint64_t z = (random += 0x9E3779B97F4A7C15);
+            z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9;
+            z = (z ^ (z >> 27)) * 0x94D049BB133111EB;
+            return z ^ (z >> 31);
+        }
+
+        /*!
+         * \brief Quotes a field of a CSV file if needed.
+         */
+        std::string csvField(std::string const &field) {
+            if(field.find_first_of(",\"\n") == std::string::npos) {
+                return field;
+            }
+            std::string quoted = "\"";
+            for(char c : field) {
+                if(c == '"') {
+                    quoted += '"';
+                }
+                quoted += c;
+            }
+            return quoted + '"';
+        }
+
+        std::ofstream openCsv(std::string const &path) {
+            std::ofstream stream(path);
+            if(!stream) {
+                throw Utils::LoadingException(path, false);
+            }
+            stream << std::fixed << std::setprecision(4);
+            return stream;
+        }
+    } // namespace
+
+    Tournament::Tournament(std::vector<SimTeam> teams, TournamentConfig const &config, unsigned int threads)
+        : teams(std::move(teams))
+        , config(config)
+        , ai(config.aiLevel, config.aiBudget)
+        , pool(threads > 0 ? threads - 1 : std::max(std::thread::hardware_concurrency(), 1u) - 1) {
+        if(this->teams.size() < 2) {
+            throw Utils::UnexpectedValueException(std::to_string(this->teams.size()) + " teams", "at least two teams in a tournament", true);
+        }
+
+        std::map<std::string, int> indexes;
+        for(SimTeam &team : this->teams) {
+            int moves[4];
+            team.opmons.erase(std::remove_if(team.opmons.begin(), team.opmons.end(), [&moves](Combatant const &opmon) { return BattleEngine::listMoves(opmon, moves) == 0; }),
+                              team.opmons.end());
+            if(team.opmons.empty()) {
+                throw Utils::UnexpectedValueException(team.name, "a team with at least one OpMon knowing a move", true);
+            }
+            if(team.opmons.size() > SIM_MAX_TEAM_SIZE) {
+                team.opmons.resize(SIM_MAX_TEAM_SIZE);
+            }
+
+            std::vector<std::array<int, 4>> &teamIndexes = moveIndexes.emplace_back();
+            for(Combatant const &opmon : team.opmons) {
+                std::array<int, 4> &slots = teamIndexes.emplace_back();
+                for(int slot = 0; slot < 4; slot++) {
+                    if(opmon.moves[slot] == nullptr) {
+                        slots[slot] = -1;
+                        continue;
+                    }
+                    auto [itor, added] = indexes.emplace(opmon.moves[slot]->getId(), moveIds.size());
+                    if(added) {
+                        moveIds.push_back(itor->first);
+                    }
+                    slots[slot] = itor->second;
+                }
+            }
+        }
+
+        std::size_t count = this->teams.size();
+        wins.assign(count * count, 0);
+        played.assign(count * count, 0);
+        scores.assign(count, 0);
+        byes.assign(count, 0);
+        usage.resize(moveIds.size());
+    }
+
+    void Tournament::run() {
+        if(config.format == Format::ROUND_ROBIN) {
+            playRound(pairRoundRobin(), 0);
+            return;
+        }
+        int rounds = config.rounds;
+        if(rounds <= 0) {
+            rounds = 1;
+            while(((std::size_t)1 << rounds) < teams.size()) {
+                rounds++;
+            }
+        }
+        for(int round = 0; round < rounds; round++) {
+            Utils::Log::oplog("Playing round " + std::to_string(round + 1) + " of " + std::to_string(rounds));
+            playRound(pairSwiss(), round);
+        }
+    }
+
+    void Tournament::playRound(std::vector<Pairing> const &pairings, int round) {
+        std::size_t count = teams.size();
+        std::uint64_t roundRandom = config.seed + (std::uint64_t)round;
+        std::uint64_t roundSeed = mix(roundRandom);
+        std::size_t chunks = (config.battles + SIM_CHUNK_SIZE - 1) / SIM_CHUNK_SIZE;
+        //The battles won by each team of each pairing during the round
+        std::vector<std::uint64_t> matchWins(pairings.size() * 2, 0);
+
+        //The threads take the chunks one after the other, so a thread which has finished its chunk takes the next one instead of waiting for the others.
+        pool.run(pairings.size() * chunks, [&](std::size_t task) {
+            std::size_t pairingIndex = task / chunks;
+            Pairing const &pairing = pairings[pairingIndex];
+            std::size_t begin = (task % chunks) * SIM_CHUNK_SIZE;
+            std::size_t end = std::min<std::size_t>(begin + SIM_CHUNK_SIZE, config.battles);
+
+            WorkerData data;
+            data.usage.resize(moveIds.size());
+            std::uint64_t won[2] = {0, 0};
+            for(std::size_t battle = begin; battle < end; battle++) {
+                std::uint64_t random = roundSeed ^ ((std::uint64_t)pairing.first << 48) ^ ((std::uint64_t)pairing.second << 32) ^ battle;
+                std::uint64_t seed = mix(random);
+                //The teams swap sides after each battle, as the side breaks the speed ties
+                bool swapped = battle % 2 == 1;
+                int winner = swapped ? playBattle(pairing.second, pairing.first, seed, data) : playBattle(pairing.first, pairing.second, seed, data);
+                if(winner >= 0) {
+                    won[swapped ? 1 - winner : winner]++;
+                }
+            }
+
+            std::lock_guard<std::mutex> lock(mutex);
+            wins[pairing.first * count + pairing.second] += won[0];
+            wins[pairing.second * count + pairing.first] += won[1];
+            played[pairing.first * count + pairing.second] += end - begin;
+            played[pairing.second * count + pairing.first] += end - begin;
+            matchWins[pairingIndex * 2] += won[0];
+            matchWins[pairingIndex * 2 + 1] += won[1];
+            for(std::size_t i = 0; i < usage.size(); i++) {
+                usage[i].uses += data.usage[i].uses;
+                usage[i].battles += data.usage[i].battles;
+                usage[i].wins += data.usage[i].wins;
+            }
+        });
+
+        for(std::size_t i = 0; i < pairings.size(); i++) {
+            std::uint64_t first = matchWins[i * 2];
+            std::uint64_t second = matchWins[i * 2 + 1];
+            scores[pairings[i].first] += (first > second) ? 1 : (first == second ? 0.5f : 0);
+            scores[pairings[i].second] += (second > first) ? 1 : (first == second ? 0.5f : 0);
+        }
+    }
+
+    int Tournament::playBattle(int first, int second, std::uint64_t seed, WorkerData &data) const {
+        int const teamIndexes[2] = {first, second};
+        std::size_t current[2] = {0, 0};
+        //The move slots used by each OpMon of each team
+        bool used[2][SIM_MAX_TEAM_SIZE][4] = {};
+
+        BattleState state = {};
+        state.count = 2;
+        for(int side = 0; side < 2; side++) {
+            state.combatants[side] = teams[teamIndexes[side]].opmons[0];
+            state.combatants[side].team = side;
+        }
+        std::uint64_t random = seed;
+        state.random = mix(random);
+
+        int winner = -1;
+        BattleChoice choices[2];
+        for(int turn = 0; turn < SIM_MAX_TURNS; turn++) {
+            for(int side = 0; side < 2; side++) {
+                choices[side] = choose(state, side, random, data.batch);
+            }
+            bool over = BattleEngine::resolveTurn(state, choices, data.log);
+            for(BattleLogEntry const &entry : data.log) {
+                if(entry.type == BattleLogType::MOVE) {
+                    data.usage[moveIndexes[teamIndexes[entry.side]][current[entry.side]][entry.value]].uses++;
+                    used[entry.side][current[entry.side]][entry.value] = true;
+                }
+            }
+            if(!over) {
+                continue;
+            }
+
+            //Each K.O. OpMon is replaced by the next one of its team
+            bool defeated[2] = {false, false};
+            for(int side = 0; side < 2; side++) {
+                if(state.combatants[side].hp > 0) {
+                    continue;
+                }
+                std::vector<Combatant> const &opmons = teams[teamIndexes[side]].opmons;
+                if(++current[side] < opmons.size()) {
+                    state.combatants[side] = opmons[current[side]];
+                    state.combatants[side].team = side;
+                } else {
+                    defeated[side] = true;
+                }
+            }
+            if(defeated[0] || defeated[1]) {
+                winner = (defeated[0] && defeated[1]) ? -1 : (defeated[0] ? 1 : 0);
+                break;
+            }
+        }
+
+        for(int side = 0; side < 2; side++) {
+            //A move known by several OpMons of the team is counted once per battle
+            int moves[SIM_MAX_TEAM_SIZE * 4];
+            int count = 0;
+            std::vector<std::array<int, 4>> const &slots = moveIndexes[teamIndexes[side]];
+            for(std::size_t opmon = 0; opmon < slots.size(); opmon++) {
+                for(int slot = 0; slot < 4; slot++) {
+                    if(used[side][opmon][slot]) {
+                        moves[count++] = slots[opmon][slot];
+                    }
+                }
+            }
+            std::sort(moves, moves + count);
+            count = std::unique(moves, moves + count) - moves;
+            for(int i = 0; i < count; i++) {
+                data.usage[moves[i]].battles++;
+                data.usage[moves[i]].wins += (winner == side);
+            }
+        }
+        return winner;
+    }
+
+    BattleChoice Tournament::choose(BattleState const &state, int side, std::uint64_t &random, DamageBatch &batch) const {
+        if(config.policy == Policy::AI) {
+            return ai.search(state, side, (unsigned int)mix(random));
+        }
+
+        Combatant const &user = state.combatants[side];
+        int target = BattleEngine::getTarget(state, side, -1);
+        int moves[4];
+        int count = BattleEngine::listMoves(user, moves);
+        BattleChoice choice = {Elements::TurnType::MOVE, moves[mix(random) % count], target};
+        if(config.policy != Policy::GREEDY || count == 1 || target < 0) {
+            return choice;
+        }
+
+        //If no move can hurt the target, the random choice is kept
+        batch.clear();
+        for(int i = 0; i < count; i++) {
+            batch.add(user, state.combatants[target], *user.moves[moves[i]]);
+        }
+        batch.estimate();
+        float best = 0;
+        for(int i = 0; i < count; i++) {
+            if(batch.expectedDamage[i] > best) {
+                best = batch.expectedDamage[i];
+                choice.move = moves[i];
+            }
+        }
+        return choice;
+    }
+
+    std::vector<Tournament::Pairing> Tournament::pairRoundRobin() const {
+        std::vector<Pairing> pairings;
+        for(std::size_t first = 0; first < teams.size(); first++) {
+            for(std::size_t second = first + 1; second < teams.size(); second++) {
+                pairings.push_back({(int)first, (int)second});
+            }
+        }
+        return pairings;
+    }
+
+    std::vector<Tournament::Pairing> Tournament::pairSwiss() {
+        std::size_t count = teams.size();
+        std::vector<int> ranking = getRanking();
+        std::vector<bool> paired(count, false);
+        std::vector<Pairing> pairings;
+        for(std::size_t i = 0; i < count; i++) {
+            int team = ranking[i];
+            if(paired[team]) {
+                continue;
+            }
+            //The next team of the ranking which hasn't been met yet, or the next one if all of them have been met
+            int opponent = -1;
+            for(std::size_t j = i + 1; j < count; j++) {
+                int other = ranking[j];
+                if(paired[other]) {
+                    continue;
+                }
+                if(opponent < 0) {
+                    opponent = other;
+                }
+                if(played[team * count + other] == 0) {
+                    opponent = other;
+                    break;
+                }
+            }
+            if(opponent < 0) {
+                //The last team isn't paired if the number of teams is odd, and gets the point of the round.
+                byes[team]++;
+                scores[team] += 1;
+                continue;
+            }
+            paired[team] = true;
+            paired[opponent] = true;
+            pairings.push_back({team, opponent});
+        }
+        return pairings;
+    }
+
+    std::vector<int> Tournament::getRanking() const {
+        std::size_t count = teams.size();
+        std::vector<double> winRates(count, 0);
+        for(std::size_t team = 0; team < count; team++) {
+            std::uint64_t won = 0;
+            std::uint64_t total = 0;
+            for(std::size_t other = 0; other < count; other++) {
+                won += wins[team * count + other];
+                total += played[team * count + other];
+            }
+            winRates[team] = total > 0 ? (double)won / total : 0;
+        }
+
+        std::vector<int> ranking(count);
+        for(std::size_t i = 0; i < count; i++) {
+            ranking[i] = i;
+        }
+        //The teams with the same score are ranked by the rate of battles won
+        std::stable_sort(ranking.begin(), ranking.end(), [&](int a, int b) {
+            return scores[a] != scores[b] ? scores[a] > scores[b] : winRates[a] > winRates[b];
+        });
+        return ranking;
+    }
+
+    void Tournament::writeWinRates(std::string const &path) const {
+        std::ofstream stream = openCsv(path);
+        std::size_t count = teams.size();
+        stream << "team";
+        for(SimTeam const &team : teams) {
+            stream << ',' << csvField(team.name);
+        }
+        stream << ",overall\n";
+        for(std::size_t team = 0; team < count; team++) {
+            stream << csvField(teams[team].name);
+            std::uint64_t won = 0;
+            std::uint64_t total = 0;
+            for(std::size_t other = 0; other < count; other++) {
+                std::uint64_t games = played[team * count + other];
+                stream << ',';
+                if(games > 0) {
+                    stream << (double)wins[team * count + other] / games;
+                }
+                won += wins[team * count + other];
+                total += games;
+            }
+            stream << ',';
+            if(total > 0) {
+                stream << (double)won / total;
+            }
+            stream << '\n';
+        }
+        if(!stream) {
+            throw Utils::LoadingException(path, false);
+        }
+    }
+
+    void Tournament::writeMoveUsage(std::string const &path) const {
+        std::vector<std::size_t> order(moveIds.size());
+        for(std::size_t i = 0; i < order.size(); i++) {
+            order[i] = i;
+        }
+        std::stable_sort(order.begin(), order.end(), [this](std::size_t a, std::size_t b) { return usage[a].uses > usage[b].uses; });
+
+        std::ofstream stream = openCsv(path);
+        stream << "move,uses,battles,wins,win_rate\n";
+        for(std::size_t i : order) {
+            MoveUsage const &move = usage[i];
+            stream << csvField(moveIds[i]) << ',' << move.uses << ',' << move.battles << ',' << move.wins << ',';
+            if(move.battles > 0) {
+                stream << (double)move.wins / move.battles;
+            }
+            stream << '\n';
+        }
+        if(!stream) {
+            throw Utils::LoadingException(path, false);
+        }
+    }
+
+    void Tournament::writeStandings(std::string const &path) const {
+        std::size_t count = teams.size();
+        std::ofstream stream = openCsv(path);
+        stream << "rank,team,score,byes,wins,losses,draws\n";
+        std::vector<int> ranking = getRanking();
+        for(std::size_t rank = 0; rank < count; rank++) {
+            int team = ranking[rank];
+            std::uint64_t won = 0;
+            std::uint64_t lost = 0;
+            std::uint64_t total = 0;
+            for(std::size_t other = 0; other < count; other++) {
+                won += wins[team * count + other];
+                lost += wins[other * count + team];
+                total += played[team * count + other];
+            }
+            stream << rank + 1 << ',' << csvField(teams[team].name) << ',' << std::setprecision(1) << scores[team] << std::setprecision(4) << ',' << byes[team] << ','
+                   << won << ',' << lost << ',' << total - won - lost << '\n';
+        }
+        if(!stream) {
+            throw Utils::LoadingException(path, false);
+        }
+    }
+
+} // namespace OpMon::Sim
@@ -0,0 +1,244 @@
+/*!
+ * \file Tournament.hpp
+ * \author Cyrielle
+ * \copyright GNU GPL v3.0
+ */
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "../../utils/WorkerPool.hpp"
+#include "../model/BattleAI.hpp"
+#include "../model/BattleEngine.hpp"
+#include "../model/DamageBatch.hpp"
+
+/*!
+ * \brief The default number of battles played by two teams when they meet.
+ */
+#define SIM_DEFAULT_BATTLES 100
+/*!
+ * \brief The number of turns after which a battle is a draw.
+ */
+#define SIM_MAX_TURNS 500
+/*!
+ * \brief The number of battles given to a thread at once.
+ */
+#define SIM_CHUNK_SIZE 16
+/*!
+ * \brief The maximum number of OpMons in a team, as in OpTeam.
+ */
+#define SIM_MAX_TEAM_SIZE 6
+
+namespace OpMon {
+
+    /*!
+     * \brief Contains the battle simulator, which plays battles between teams without showing them.
+     */
+    namespace Sim {
+
+        /*!
+         * \brief The way the combatants choose their moves.
+         */
+        enum class Policy {
+            RANDOM, /*!< A random move among the usable ones.*/
+            GREEDY, /*!< The move doing the most damages on average, estimated with DamageBatch.*/
+            AI /*!< The choice of BattleAI.*/
+        };
+
+        /*!
+         * \brief The way the teams are paired.
+         */
+        enum class Format {
+            ROUND_ROBIN, /*!< Each team meets all the others once.*/
+            SWISS /*!< At each round, each team meets a team with the same score it hasn't met yet.*/
+        };
+
+        struct TournamentConfig {
+            Format format = Format::ROUND_ROBIN;
+            /*!
+             * \brief The number of rounds of a Swiss tournament. If 0, enough rounds are played to separate the teams (log2 of the number of teams).
+             */
+            int rounds = 0;
+            /*!
+             * \brief The number of battles played each time two teams meet.
+             */
+            int battles = SIM_DEFAULT_BATTLES;
+            Policy policy = Policy::GREEDY;
+            int aiLevel = AI_DEFAULT_LEVEL;
+            int aiBudget = AI_DEFAULT_BUDGET;
+            /*!
+             * \brief The seed from which the seeds of all the battles are derived.
+             * \details The simulator also seeds the generator drawing the stats of the OpMons with it (see Utils::Misc::getRNGEngine), so a tournament can be played again.
+             */
+            std::uint64_t seed = 0;
+        };
+
+        /*!
+         * \brief A team taking part in a tournament.
+         */
+        struct SimTeam {
+            std::string name;
+            /*!
+             * \brief The OpMons of the team, in the order in which they fight, at most SIM_MAX_TEAM_SIZE of them. Their team field is ignored.
+             * \details The moves are only read, so the teams can be shared by all the threads.
+             */
+            std::vector<Combatant> opmons;
+        };
+
+        /*!
+         * \brief The statistics of a move during a tournament.
+         */
+        struct MoveUsage {
+            /*!
+             * \brief The number of times the move has been used.
+             */
+            std::uint64_t uses = 0;
+            /*!
+             * \brief The number of battles in which the move has been used.
+             */
+            std::uint64_t battles = 0;
+            /*!
+             * \brief The number of battles in which the move has been used by the winning team.
+             */
+            std::uint64_t wins = 0;
+        };
+
+        /*!
+         * \brief Plays a tournament between teams, with BattleEngine.
+         * \details A battle between two teams is a series of battles between two OpMons : when an OpMon is K.O., the next one of its team replaces it, and the battle
+         * ends when a team has no more OpMon. When two teams meet, they play TournamentConfig::battles battles, swapping sides after each one, and the team winning
+         * the most battles gets a point (half a point each if they are tied).
+         *
+         * The battles are shared between the threads of a Utils::WorkerPool, in chunks of a few battles. The seed of a battle only depends on the seed of the tournament,
+         * the teams and the index of the battle, so the results don't depend on the number of threads (except with Policy::AI, whose search is limited by time).
+         */
+        class Tournament {
+          public:
+            /*!
+             * \param threads The number of threads playing the battles, 0 to use all the cores.
+             * \throws Utils::UnexpectedValueException if there are less than two teams, or if a team has no OpMon with a move.
+             */
+            Tournament(std::vector<SimTeam> teams, TournamentConfig const &config, unsigned int threads = 0);
+
+            /*!
+             * \brief Plays all the rounds of the tournament.
+             */
+            void run();
+
+            /*!
+             * \brief Writes the matrix of the win rates in a CSV file.
+             * \details The cell of the row `i` and the column `j` is the rate of the battles against `j` won by `i`, empty if they haven't met.
+             * The last column is the rate of all the battles won by `i`.
+             * \throws Utils::LoadingException if the file can't be written.
+             */
+            void writeWinRates(std::string const &path) const;
+            /*!
+             * \brief Writes the statistics of the moves in a CSV file, the most used moves first.
+             * \throws Utils::LoadingException if the file can't be written.
+             */
+            void writeMoveUsage(std::string const &path) const;
+            /*!
+             * \brief Writes the ranking of the teams in a CSV file.
+             * \throws Utils::LoadingException if the file can't be written.
+             */
+            void writeStandings(std::string const &path) const;
+
+            /*!
+             * \brief Returns the indexes of the teams, from the first to the last of the ranking.
+             */
+            std::vector<int> getRanking() const;
+            SimTeam const &getTeam(int index) const {
+                return teams[index];
+            }
+            float getScore(int index) const {
+                return scores[index];
+            }
+
+          private:
+            /*!
+             * \brief Two teams meeting during a round.
+             */
+            struct Pairing {
+                int first;
+                int second;
+            };
+
+            /*!
+             * \brief The data used by a thread while it plays battles, merged with the results of the tournament once the battles are played.
+             */
+            struct WorkerData {
+                /*!
+                 * \brief The statistics of the moves, indexed like moveIds.
+                 */
+                std::vector<MoveUsage> usage;
+                BattleLog log;
+                /*!
+                 * \brief Used by Policy::GREEDY to estimate the damages.
+                 */
+                DamageBatch batch;
+            };
+
+            /*!
+             * \brief Plays the battles of the pairings of a round in parallel, and gives the points of the round.
+             * \param round The index of the round, mixed into the seeds so two teams meeting again don't replay the same battles.
+             */
+            void playRound(std::vector<Pairing> const &pairings, int round);
+            /*!
+             * \brief Plays a battle between two teams, `first` being on the side 0.
+             * \param seed The seed of the battle.
+             * \returns 0 if `first` won, 1 if `second` won, -1 for a draw.
+             */
+            int playBattle(int first, int second, std::uint64_t seed, WorkerData &data) const;
+            /*!
+             * \brief Chooses the action of a combatant for a turn.
+             * \param random The generator used by Policy::RANDOM and by the search of Policy::AI.
+             */
+            BattleChoice choose(BattleState const &state, int side, std::uint64_t &random, DamageBatch &batch) const;
+
+            /*!
+             * \brief Pairs the teams for the next round.
+             */
+            std::vector<Pairing> pairRoundRobin() const;
+            std::vector<Pairing> pairSwiss();
+
+            std::vector<SimTeam> teams;
+            TournamentConfig config;
+            BattleAI ai;
+            Utils::WorkerPool pool;
+
+            /*!
+             * \brief The identifiers of all the moves used by the teams.
+             */
+            std::vector<std::string> moveIds;
+            /*!
+             * \brief The index in moveIds of each move slot of each OpMon, indexed by team, then by OpMon, then by slot.
+             */
+            std::vector<std::vector<std::array<int, 4>>> moveIndexes;
+
+            /*!
+             * \brief The number of battles won by each team against each other, `wins[i * teams.size() + j]` being the battles won by `i` against `j`.
+             */
+            std::vector<std::uint64_t> wins;
+            /*!
+             * \brief The number of battles played by each team against each other, indexed like `wins`.
+             */
+            std::vector<std::uint64_t> played;
+            std::vector<float> scores;
+            /*!
+             * \brief The number of rounds in which each team hasn't been paired.
+             */
+            std::vector<int> byes;
+            std::vector<MoveUsage> usage;
+            /*!
+             * \brief Protects the results while the threads merge theirs.
+             */
+            std::mutex mutex;
+        };
+
+    } // namespace Sim
+
+} // namespace OpMon
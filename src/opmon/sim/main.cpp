@@ -0,0 +1,233 @@
+/*
+main.cpp
+Author : Cyrielle
+File under GNU GPL v3.0 license
+*/
+#include <algorithm>
+#include <cstdint>
+#include <filesystem>
+#include <iostream>
+#include <map>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "../../utils/exceptions.hpp"
+#include "../../utils/fs.hpp"
+#include "../../utils/log.hpp"
+#include "../../utils/misc.hpp"
+#include "../../utils/ResourceLoader.hpp"
+#include "../../utils/i18n/Translator.hpp"
+#include "../core/system/path.hpp"
+#include "../model/BattleEngine.hpp"
+#include "../model/BattleReplay.hpp"
+#include "../model/Move.hpp"
+#include "../model/OpTeam.hpp"
+#include "../model/Species.hpp"
+#include "Tournament.hpp"
+
+using Utils::Log::oplog;
+
+/*
+ * The battle simulator : plays a tournament between the teams of the trainers, with the battle engine of the game but without any window,
+ * and writes the results in CSV files.
+ */
+
+namespace OpMon::Sim {
+
+    namespace {
+        void printHelp() {
+            std::cout << "Usage: opmon-sim [options]" << std::endl;
+            std::cout << "--teams <dir> : The directory of the json files of the teams, in the format of the trainers. Default: the trainers of the game." << std::endl;
+            std::cout << "--format <round-robin|swiss> : The format of the tournament. Default: round-robin." << std::endl;
+            std::cout << "--rounds <n> : The number of rounds of a Swiss tournament. Default: log2 of the number of teams." << std::endl;
+            std::cout << "--battles <n> : The number of battles played each time two teams meet. Default: " << SIM_DEFAULT_BATTLES << "." << std::endl;
+            std::cout << "--policy <random|greedy|ai> : The way the OpMons choose their moves. Default: greedy." << std::endl;
+            std::cout << "--ai-level <n> : The level of the AI, with --policy ai. Default: " << AI_DEFAULT_LEVEL << "." << std::endl;
+            std::cout << "--ai-budget <ms> : The time given to the AI to choose a move, with --policy ai. Default: " << AI_DEFAULT_BUDGET << "." << std::endl;
+            std::cout << "--seed <n> : The seed of the tournament, used for the stats of the OpMons and for the battles. Default: 0." << std::endl;
+            std::cout << "--threads <n> : The number of threads playing the battles. Default: all the cores." << std::endl;
+            std::cout << "--out <dir> : The directory in which winrates.csv, moves.csv and standings.csv are written. Default: the current directory." << std::endl;
+            std::cout << "--verify <dir> : Plays again all the recorded battles (" << REPLAY_EXTENSION << " files) of the directory instead of a tournament, and checks that they end the same way." << std::endl;
+            std::cout << "--help : Prints this message and quit." << std::endl;
+        }
+
+        /*!
+         * \brief Loads the strings and the moves, without any of the resources used by the screens.
+         */
+        void loadMoves() {
+            auto &tr = Utils::I18n::Translator::getInstance();
+            tr.setAvailableLanguages({{"en", "keys/english.rkeys"}});
+            tr.setLang("en");
+
+            Move::initMoves(std::filesystem::directory_iterator(Path::getResourcePath() + "data/moves"));
+        }
+
+        /*!
+         * \brief Loads the strings, the moves, the species and the teams.
+         * \details The individual values and the natures of the OpMons are drawn with Utils::Misc::getRNGEngine, which is seeded first with `seed` : the same seed
+         * always gives the same stats.
+         */
+        std::vector<SimTeam> loadTeams(std::string const &teamsPath, std::uint64_t seed, std::map<unsigned int, Species *> &species, std::map<std::string, OpTeam *> &trainers) {
+            std::seed_seq seedSequence{(std::uint32_t)seed, (std::uint32_t)(seed >> 32)};
+            Utils::Misc::getRNGEngine().seed(seedSequence);
+            loadMoves();
+            Species::initSpecies(std::filesystem::directory_iterator(Path::getResourcePath() + "data/species"), species);
+            OpTeam::initTrainers(std::filesystem::directory_iterator(teamsPath), species, trainers);
+
+            std::vector<SimTeam> teams;
+            for(auto const &[name, trainer] : trainers) {
+                SimTeam &team = teams.emplace_back();
+                team.name = name;
+                for(OpMon *opmon : trainer->getOpTeam()) {
+                    team.opmons.push_back(BattleEngine::makeCombatant(*opmon, 0));
+                }
+            }
+            return teams;
+        }
+
+        /*!
+         * \brief Plays again the recorded battles of a directory with BattleReplay::verify.
+         * \returns 0 if all the battles end as when they were recorded, 1 otherwise.
+         */
+        int verify(std::string const &replaysPath) {
+            std::vector<std::string> paths;
+            std::error_code error;
+            for(std::filesystem::directory_entry const &file : std::filesystem::directory_iterator(replaysPath, error)) {
+                if(file.is_regular_file() && file.path().extension() == REPLAY_EXTENSION) {
+                    paths.push_back(file.path().string());
+                }
+            }
+            if(error) {
+                std::cerr << "Can't read the directory " << replaysPath << ": " << error.message() << std::endl;
+                return 1;
+            }
+            std::sort(paths.begin(), paths.end());
+
+            loadMoves();
+            std::size_t failed = 0;
+            for(std::string const &path : paths) {
+                try {
+                    if(!BattleReplay::load(path).verify()) {
+                        std::cout << "DIFFERENT " << path << std::endl;
+                        failed++;
+                    }
+                } catch(Utils::Exception &e) {
+                    std::cout << "INVALID " << path << ": " << e.desc() << std::endl;
+                    failed++;
+                }
+            }
+            std::cout << paths.size() - failed << "/" << paths.size() << " battles verified." << std::endl;
+            return failed == 0 ? 0 : 1;
+        }
+
+        int run(TournamentConfig const &config, unsigned int threads, std::string teamsPath, std::string const &outPath, std::string const &replaysPath) {
+            Utils::Log::init(Path::getLogPath());
+            oplog("Starting the battle simulator.");
+            Utils::ResourceLoader::setResourcePath(Path::getResourcePath());
+            if(!Utils::ResourceLoader::checkResourceFolderExists() || (replaysPath.empty() && !Utils::Fs::mkdir(outPath))) {
+                oplog("Problems found with the directories, quitting.", true);
+                return -1;
+            }
+            if(teamsPath.empty()) {
+                teamsPath = Path::getResourcePath() + "data/trainers";
+            }
+
+            std::map<unsigned int, Species *> species;
+            std::map<std::string, OpTeam *> trainers;
+            int result = 0;
+            try {
+                if(!replaysPath.empty()) {
+                    oplog("Verifying the recorded battles.");
+                    result = verify(replaysPath);
+                } else {
+                    Tournament tournament(loadTeams(teamsPath, config.seed, species, trainers), config, threads);
+                    oplog("Playing the tournament.");
+                    tournament.run();
+                    tournament.writeWinRates(outPath + "/winrates.csv");
+                    tournament.writeMoveUsage(outPath + "/moves.csv");
+                    tournament.writeStandings(outPath + "/standings.csv");
+
+                    std::vector<int> ranking = tournament.getRanking();
+                    for(std::size_t rank = 0; rank < ranking.size(); rank++) {
+                        std::cout << rank + 1 << ". " << tournament.getTeam(ranking[rank]).name << " (" << tournament.getScore(ranking[rank]) << ")" << std::endl;
+                    }
+                    std::cout << "Results written in " << outPath << std::endl;
+                }
+            } catch(Utils::Exception &e) {
+                oplog("Exception reached the simulator: " + e.desc(), true);
+                std::cerr << e.desc() << std::endl;
+                result = e.returnId;
+            } catch(std::exception &e) {
+                oplog("Unexpected exception occured: " + std::string(e.what()), true);
+                std::cerr << e.what() << std::endl;
+                result = 1;
+            }
+
+            for(auto &[name, trainer] : trainers) {
+                delete(trainer);
+            }
+            for(auto &[number, opSpecies] : species) {
+                delete(opSpecies);
+            }
+            return result;
+        }
+    } // namespace
+
+} // namespace OpMon::Sim
+
+int main(int argc, char *argv[]) {
+    using namespace OpMon::Sim;
+    TournamentConfig config;
+    unsigned int threads = 0;
+    std::string teamsPath;
+    std::string outPath = ".";
+    std::string replaysPath;
+
+    for(int i = 1; i < argc; i++) {
+        std::string str = std::string(argv[i]);
+        if(str == "--help") {
+            printHelp();
+            return 0;
+        }
+        if(i + 1 >= argc) {
+            std::cerr << "Unknown option or missing value: " << str << std::endl;
+            printHelp();
+            return 1;
+        }
+        std::string value = argv[++i];
+        try {
+            if(str == "--teams") {
+                teamsPath = value;
+            } else if(str == "--format" && (value == "round-robin" || value == "swiss")) {
+                config.format = (value == "swiss") ? Format::SWISS : Format::ROUND_ROBIN;
+            } else if(str == "--rounds") {
+                config.rounds = std::stoi(value);
+            } else if(str == "--battles") {
+                config.battles = std::max(1, std::stoi(value));
+            } else if(str == "--policy" && (value == "random" || value == "greedy" || value == "ai")) {
+                config.policy = (value == "random") ? Policy::RANDOM : (value == "ai" ? Policy::AI : Policy::GREEDY);
+            } else if(str == "--ai-level") {
+                config.aiLevel = std::stoi(value);
+            } else if(str == "--ai-budget") {
+                config.aiBudget = std::stoi(value);
+            } else if(str == "--seed") {
+                config.seed = std::stoull(value);
+            } else if(str == "--threads") {
+                threads = std::stoul(value);
+            } else if(str == "--out") {
+                outPath = value;
+            } else if(str == "--verify") {
+                replaysPath = value;
+            } else {
+                std::cerr << "Unknown option or invalid value: " << str << " " << value << std::endl;
+                printHelp();
+                return 1;
+            }
+        } catch(std::logic_error &e) {
+            std::cerr << "Invalid number for " << str << ": " << value << std::endl;
+            return 1;
+        }
+    }
+    return run(config, threads, teamsPath, outPath, replaysPath);
+}
@@ -20,6 +20,7 @@ File under GNU GPL v3.0 license
 #include "src/utils/OpString.hpp"
 #include "events/AnimationEvent.hpp"
 #include "events/SoundEvent.hpp"
+#include "events/ScriptEvent.hpp"
 
 namespace sf {
 	class String;
@@ -48,13 +49,21 @@ namespace OpMon {
 
 			this->w = w;
 			this->h = h;
+			events.setSize(sf::Vector2i(w, h));
+
+			//The walls stop the sight of the events.
+			std::vector<char> opaque(w * h);
+			for(int y = 0; y < h; y++) {
+				for(int x = 0; x < w; x++) {
+					opaque[x + y * w] = getCollision(sf::Vector2i(x, y)) == 1;
+				}
+			}
+			events.setOpaque(opaque);
+			pathfinder.build(*this);
 		}
 
 		Map::~Map() {
 			if(loaded) {
-				for(AbstractEvent *event : events) {
-					delete(event);
-				}
 				free(layer1);
 				free(layer2);
 				free(layer3);
@@ -81,6 +90,9 @@ namespace OpMon {
 						jsonData.at("music"),
 						jsonData.value("animations", std::vector<std::string>()));
 
+				//All the events of the map, including the events contained in meta events, are allocated in the map's arena.
+				Utils::Arena::Scope arenaScope(currentMap->eventArena);
+
 				for(nlohmann::json event : jsonData.at("events")){
 					std::string type = event.at("type");
 					if(type == "TP") currentMap->addEvent(new TPEvent(data, event));
@@ -93,6 +105,7 @@ namespace OpMon {
 					else if(type == "TalkingCharacter") currentMap->addEvent(new TalkingCharaEvent(data, event));
 					else if(type == "Door") currentMap->addEvent(new DoorEvent(data, event));
 					else if(type == "LinearMeta") currentMap->addEvent(new LinearMetaEvent(data, event));
+					else if(type == "Script") currentMap->addEvent(new ScriptEvent(data, event));
 				}
 				return currentMap;
 			} else {
@@ -101,21 +114,6 @@ namespace OpMon {
 			}
 		}
 
-		std::list<AbstractEvent *> Map::getEvent(sf::Vector2i position) const {
-			if(loaded) {
-				std::list<AbstractEvent *> toReturn;
-
-				for(AbstractEvent *event : events) {
-					if(event->getPositionMap().getPosition().x == position.x && event->getPositionMap().getPosition().y == position.y) {
-						toReturn.push_back(event);
-					}
-				}
-				return toReturn;
-			} else {
-				throw Utils::UnloadedResourceException("Map", "Map::getEvent");
-			}
-		}
-
 		int Map::getCurrentTileCode(sf::Vector2i const &pos, int layer) const {
 			if(loaded) {
 				switch(layer) {
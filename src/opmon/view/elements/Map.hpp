@@ -15,9 +15,11 @@
 #define MAP_HPP
 
 #include <SFML/Graphics/RenderTexture.hpp>
-#include <list>
 
 #include "../../../nlohmann/json.hpp"
+#include "../../../utils/Arena.hpp"
+#include "Pathfinder.hpp"
+#include "events/EventStore.hpp"
 
 namespace sf {
 class RenderTexture;
@@ -29,8 +31,6 @@ namespace OpMon {
 
     namespace Elements {
 
-        class AbstractEvent;
-
         /*!
          * \brief Defines a specific place in a game, containing the event, the animated objects and the map layers.
          * \details To lower the loading time, a map object can be created without initialisation. The data of the map is stored in Map::jsonData, and the map can then be loaded by calling Map::loadMap. Using an unloaded map will crash the game.
@@ -63,7 +63,19 @@ namespace OpMon {
 
             Map(Map const &toCopy) = delete;
 
-            std::vector<AbstractEvent *> events;
+            /*!
+             * \brief The memory in which the events of the map are allocated by loadMap.
+             * \details Declared before \ref events, so the arena is freed after the destruction of the events.
+             */
+            Utils::Arena eventArena;
+            /*!
+             * \brief The events of the map.
+             */
+            EventStore events;
+            /*!
+             * \brief Finds the ways through the map, for the npcs.
+             */
+            Pathfinder pathfinder;
             /*!
              * \brief Contains the animated elements of the map.
              * \details An animated element is an animation put on the top of the map. For exemple, the wind turbine of Fauxbourg Euvi.
@@ -140,19 +152,26 @@ namespace OpMon {
              * \warning The given event will be deleted at the destruction of the map.
              */
             void addEvent(AbstractEvent *event) {
-                events.push_back(event);
+                events.add(event);
             }
-            /*!
-             * \brief Returns all the events in the given position.
-             * \param position The position in which to search for event.
-             */
-            std::list<AbstractEvent *> getEvent(sf::Vector2i position) const;
             /*!
              * \brief Returns all the events of the map.
              */
             std::vector<AbstractEvent *> &getEvents() {
+                return events.getEvents();
+            }
+            /*!
+             * \brief Returns the store containing the data of the events of the map.
+             */
+            EventStore &getEventStore() {
                 return events;
             }
+            const EventStore &getEventStore() const {
+                return events;
+            }
+            Pathfinder &getPathfinder() {
+                return pathfinder;
+            }
             /*!
              * \brief Updates the animated elements by incrementing the animation.
              * \param frame A reference to the frame of the game.
@@ -0,0 +1,246 @@
+/*
+Pathfinder.cpp
+Author : Cyrielle
+File under GNU GPL v3.0 license
+*/
+#include "Pathfinder.hpp"
+
+#include <algorithm>
+#include <cstdlib>
+#include <functional>
+#include <limits>
+#include <queue>
+#include <utility>
+
+#include "Map.hpp"
+
+/*!
+ * \brief The maximal number of tiles processed by Pathfinder::update for each target which is being refreshed.
+ */
+#define FLOW_FIELD_BUDGET 512
+
+namespace OpMon {
+    namespace Elements {
+
+        namespace {
+            const Side moveDirs[4] = {Side::TO_UP, Side::TO_DOWN, Side::TO_LEFT, Side::TO_RIGHT};
+
+            sf::Vector2i step(Side dir) {
+                switch(dir) {
+                case Side::TO_UP:
+                    return sf::Vector2i(0, -1);
+                case Side::TO_DOWN:
+                    return sf::Vector2i(0, 1);
+                case Side::TO_LEFT:
+                    return sf::Vector2i(-1, 0);
+                case Side::TO_RIGHT:
+                    return sf::Vector2i(1, 0);
+                default:
+                    return sf::Vector2i(0, 0);
+                }
+            }
+
+            /*!
+             * \brief The collision letting an entity enter a tile only when moving in the given direction (see Position::checkPass).
+             */
+            int exclusiveCollision(Side dir) {
+                switch(dir) {
+                case Side::TO_UP:
+                    return 8;
+                case Side::TO_DOWN:
+                    return 7;
+                case Side::TO_LEFT:
+                    return 6;
+                default:
+                    return 5;
+                }
+            }
+        } // namespace
+
+        Pathfinder::Pathfinder() {
+            //The player target
+            addTarget(sf::Vector2i(-1, -1));
+        }
+
+        void Pathfinder::build(Map const &map) {
+            size = map.getDimensions();
+            entries.assign(size.x * size.y, 0);
+            for(int y = 0; y < size.y; y++) {
+                for(int x = 0; x < size.x; x++) {
+                    int colLayer1 = map.getTileCollision(map.getCurrentTileCode(sf::Vector2i(x, y), 1));
+                    int colLayer2 = map.getTileCollision(map.getCurrentTileCode(sf::Vector2i(x, y), 2));
+                    for(Side dir : moveDirs) {
+                        int exclusiveCol = exclusiveCollision(dir);
+                        if((colLayer1 == 0 || colLayer1 == exclusiveCol) && (colLayer2 == 0 || colLayer2 == exclusiveCol)) {
+                            entries[x + y * size.x] |= 1 << (int)dir;
+                        }
+                    }
+                }
+            }
+        }
+
+        int Pathfinder::tileIndex(sf::Vector2i const &tile) const {
+            if(tile.x < 0 || tile.y < 0 || tile.x >= size.x || tile.y >= size.y) {
+                return -1;
+            }
+            return tile.x + tile.y * size.x;
+        }
+
+        bool Pathfinder::canMove(sf::Vector2i const &from, Side dir) const {
+            int index = tileIndex(from + step(dir));
+            return index >= 0 && (entries[index] & (1 << (int)dir)) != 0;
+        }
+
+        bool Pathfinder::findPath(sf::Vector2i const &from, sf::Vector2i const &to, std::vector<Side> &path) const {
+            path.clear();
+            int start = tileIndex(from);
+            int goal = tileIndex(to);
+            if(start < 0 || goal < 0) {
+                return false;
+            }
+
+            std::vector<int> costs(entries.size(), std::numeric_limits<int>::max());
+            //The direction used to enter each tile, -1 if the tile has not been reached.
+            std::vector<signed char> cameFrom(entries.size(), -1);
+            //The tiles to visit, sorted by their estimated distance to the goal.
+            std::priority_queue<std::pair<int, int>, std::vector<std::pair<int, int>>, std::greater<std::pair<int, int>>> open;
+
+            costs[start] = 0;
+            open.push(std::make_pair(std::abs(to.x - from.x) + std::abs(to.y - from.y), start));
+            while(!open.empty()) {
+                int current = open.top().second;
+                int estimate = open.top().first;
+                open.pop();
+                if(current == goal) {
+                    break;
+                }
+                sf::Vector2i tile(current % size.x, current / size.x);
+                if(estimate - std::abs(to.x - tile.x) - std::abs(to.y - tile.y) > costs[current]) {
+                    //Outdated entry, the tile has been reached by a shorter path since.
+                    continue;
+                }
+                for(Side dir : moveDirs) {
+                    if(!canMove(tile, dir)) continue;
+                    sf::Vector2i next = tile + step(dir);
+                    int nextIndex = tileIndex(next);
+                    if(costs[current] + 1 < costs[nextIndex]) {
+                        costs[nextIndex] = costs[current] + 1;
+                        cameFrom[nextIndex] = (signed char)dir;
+                        open.push(std::make_pair(costs[nextIndex] + std::abs(to.x - next.x) + std::abs(to.y - next.y), nextIndex));
+                    }
+                }
+            }
+
+            if(costs[goal] == std::numeric_limits<int>::max()) {
+                return false;
+            }
+            //Goes back from the goal to the start
+            sf::Vector2i tile = to;
+            while(tile != from) {
+                Side dir = (Side)cameFrom[tileIndex(tile)];
+                path.push_back(dir);
+                tile -= step(dir);
+            }
+            std::reverse(path.begin(), path.end());
+            return true;
+        }
+
+        std::size_t Pathfinder::addTarget(sf::Vector2i const &goal) {
+            FlowField field;
+            field.goal = goal;
+            field.pendingGoal = goal;
+            field.latestGoal = goal;
+            targets.push_back(field);
+            return targets.size() - 1;
+        }
+
+        void Pathfinder::moveTarget(std::size_t target, sf::Vector2i const &goal) {
+            FlowField &field = targets[target];
+            field.latestGoal = goal;
+            //A refresh in progress is completed first, then refresh() starts again for the latest goal.
+            if(field.used && !field.refreshing && field.goal != goal) {
+                startRefresh(field);
+            }
+        }
+
+        void Pathfinder::startRefresh(FlowField &field) {
+            field.pendingGoal = field.latestGoal;
+            field.pending.assign(entries.size(), -1);
+            field.queue.clear();
+            field.queueHead = 0;
+            field.refreshing = true;
+            int goal = tileIndex(field.pendingGoal);
+            if(goal >= 0) {
+                field.pending[goal] = 0;
+                field.queue.push_back(goal);
+            }
+        }
+
+        bool Pathfinder::refresh(FlowField &field, std::size_t budget) {
+            //Breadth first search from the goal, following the movements backwards.
+            for(std::size_t processed = 0; processed < budget && field.queueHead < field.queue.size(); processed++) {
+                int current = field.queue[field.queueHead++];
+                sf::Vector2i tile(current % size.x, current / size.x);
+                for(Side dir : moveDirs) {
+                    sf::Vector2i previous = tile - step(dir);
+                    int previousIndex = tileIndex(previous);
+                    if(previousIndex >= 0 && field.pending[previousIndex] < 0 && canMove(previous, dir)) {
+                        field.pending[previousIndex] = field.pending[current] + 1;
+                        field.queue.push_back(previousIndex);
+                    }
+                }
+            }
+            if(field.queueHead < field.queue.size()) {
+                return false;
+            }
+            field.goal = field.pendingGoal;
+            field.distances.swap(field.pending);
+            field.refreshing = false;
+            if(field.latestGoal != field.goal) {
+                startRefresh(field);
+            }
+            return true;
+        }
+
+        Pathfinder::FlowField &Pathfinder::use(std::size_t target) {
+            FlowField &field = targets[target];
+            if(field.distances.empty()) {
+                if(!field.refreshing) {
+                    startRefresh(field);
+                }
+                refresh(field, std::numeric_limits<std::size_t>::max());
+            }
+            field.used = true;
+            return field;
+        }
+
+        int Pathfinder::getDistance(std::size_t target, sf::Vector2i const &from) {
+            FlowField &field = use(target);
+            int index = tileIndex(from);
+            return index < 0 ? -1 : field.distances[index];
+        }
+
+        Side Pathfinder::getDirection(std::size_t target, sf::Vector2i const &from) {
+            int distance = getDistance(target, from);
+            if(distance <= 0) {
+                return Side::NO_MOVE;
+            }
+            FlowField const &field = targets[target];
+            for(Side dir : moveDirs) {
+                if(canMove(from, dir) && field.distances[tileIndex(from + step(dir))] == distance - 1) {
+                    return dir;
+                }
+            }
+            return Side::NO_MOVE;
+        }
+
+        void Pathfinder::update() {
+            for(FlowField &field : targets) {
+                if(field.used && field.refreshing) {
+                    refresh(field, FLOW_FIELD_BUDGET);
+                }
+            }
+        }
+
+    } // namespace Elements
+} // namespace OpMon
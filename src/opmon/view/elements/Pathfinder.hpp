@@ -0,0 +1,146 @@
+/*!
+ * \file Pathfinder.hpp
+ * \author Cyrielle
+ * \copyright GNU GPL v3.0
+ */
+
+#ifndef PATHFINDER_HPP
+#define PATHFINDER_HPP
+
+#include <SFML/System/Vector2.hpp>
+#include <cstdint>
+#include <vector>
+
+#include "../../model/Enums.hpp"
+
+namespace OpMon {
+    namespace Elements {
+
+        class Map;
+
+        /*!
+         * \brief Finds the ways through a map, using the collisions of its tiles.
+         * \details Two tools are available :
+         * - findPath, an A* search for the paths computed only once (a script moving an npc to a tile, for example).
+         * - The targets, for the goals shared by several npcs (the player, a door...). For each target, a flow field giving the distance of each tile to the target is kept, so
+         * any number of npcs can head to the target with one lookup per step.
+         *
+         * When a target moves, its flow field is computed again in the background : update() processes a limited number of tiles each frame, and the old field is used until the new one is complete.
+         * If the target moves again meanwhile, the computation is not restarted : it is completed, then a new one starts for the last position of the target. The field is then always
+         * refreshed, even on large maps where the target moves faster than a field can be computed.
+         *
+         * Only the collisions of the tiles are considered, not the events : an npc blocked by an event tries again in the next frame.
+         */
+        class Pathfinder {
+          public:
+            /*!
+             * \brief The target following the player, moved by OverworldCtrl.
+             */
+            static constexpr std::size_t PLAYER_TARGET = 0;
+
+            Pathfinder();
+
+            /*!
+             * \brief Computes which tiles can be entered from which side. Has to be called once the layers of the map are loaded.
+             */
+            void build(Map const &map);
+
+            /*!
+             * \brief Searches the shortest path between two tiles, with A*.
+             * \param path Filled with the movements leading from `from` to `to`.
+             * \returns `false` if no path has been found.
+             */
+            bool findPath(sf::Vector2i const &from, sf::Vector2i const &to, std::vector<Side> &path) const;
+
+            /*!
+             * \brief Adds a target.
+             * \returns The index of the target.
+             */
+            std::size_t addTarget(sf::Vector2i const &goal);
+            /*!
+             * \brief Moves a target. Its flow field is refreshed by the next calls to update(), once the refresh in progress, if any, is complete.
+             */
+            void moveTarget(std::size_t target, sf::Vector2i const &goal);
+            /*!
+             * \brief Returns the number of steps between a tile and a target, or -1 if the target can't be reached from this tile.
+             */
+            int getDistance(std::size_t target, sf::Vector2i const &from);
+            /*!
+             * \brief Returns the direction to follow from a tile to go to a target, or Side::NO_MOVE if the tile is the target or if the target can't be reached.
+             */
+            Side getDirection(std::size_t target, sf::Vector2i const &from);
+
+            /*!
+             * \brief Continues the refreshing of the flow fields of the targets which have moved.
+             * \details Only the targets which have already been used are refreshed.
+             */
+            void update();
+
+          private:
+            /*!
+             * \brief The distances of the tiles to a target.
+             */
+            struct FlowField {
+                sf::Vector2i goal;
+                /*!
+                 * \brief The distance of each tile to \ref goal, -1 if the goal can't be reached.
+                 */
+                std::vector<int> distances;
+                /*!
+                 * \brief The goal of \ref pending, which becomes \ref goal once \ref pending is complete.
+                 */
+                sf::Vector2i pendingGoal;
+                /*!
+                 * \brief The last position given to moveTarget, for which a refresh starts when the current one is complete.
+                 */
+                sf::Vector2i latestGoal;
+                /*!
+                 * \brief The flow field being computed for \ref pendingGoal.
+                 */
+                std::vector<int> pending;
+                /*!
+                 * \brief The tiles of \ref pending whose neighbours have to be visited.
+                 */
+                std::vector<int> queue;
+                std::size_t queueHead = 0;
+                bool refreshing = false;
+                /*!
+                 * \brief If the field has been used at least once. The fields never used are not computed.
+                 */
+                bool used = false;
+            };
+
+            sf::Vector2i size;
+            /*!
+             * \brief For each tile, the sides from which it can be entered : the bit `1 << (int)side` is set if an entity moving towards `side` can enter the tile.
+             */
+            std::vector<std::uint8_t> entries;
+            std::vector<FlowField> targets;
+
+            int tileIndex(sf::Vector2i const &tile) const;
+            /*!
+             * \brief Returns `true` if an entity can go from the given tile to the next one in the given direction.
+             */
+            bool canMove(sf::Vector2i const &from, Side dir) const;
+            /*!
+             * \brief Starts the computation of the flow field of a target for its latest goal.
+             * \details The memory of the previous field is reused.
+             */
+            void startRefresh(FlowField &field);
+            /*!
+             * \brief Continues the computation of the pending flow field of a target.
+             * \details When the field is complete, a new computation is started if the target has moved since the beginning of this one.
+             * \param budget The maximal number of tiles to process.
+             * \returns `true` if the field is complete.
+             */
+            bool refresh(FlowField &field, std::size_t budget);
+            /*!
+             * \brief Makes sure a field can be used, computing it entirely if it has never been.
+             */
+            FlowField &use(std::size_t target);
+        };
+
+    } // namespace Elements
+} // namespace OpMon
+
+#endif
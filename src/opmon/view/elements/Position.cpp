@@ -10,7 +10,11 @@ File under GNU GPL v3.0 license
 
 #include "Map.hpp"
 #include "src/opmon/model/Enums.hpp"
-#include "events/AbstractEvent.hpp"
+
+/*!
+ * \brief The number of steps of the player kept in Position::playerSteps.
+ */
+#define PLAYER_STEPS_SIZE 64
 
 namespace OpMon {
     namespace Elements {
@@ -41,6 +45,10 @@ namespace OpMon {
         void Position::tp(sf::Vector2i position) {
             movement = false;
             anim = false;
+            //The steps before a teleportation can't be replayed on the new position, nor on the new map.
+            if(!event) {
+                playerSteps.clear();
+            }
 
             posX = position.x - 1;
             posY = position.y;
@@ -52,35 +60,50 @@ namespace OpMon {
         }
 
         bool Position::move(Side dir, Map *map, bool debugCol) {
-            if(!anim && !moveLock) {
-                this->dir = dir;
-
-                anim = true;
-
-                if((!event && debugCol) /*Noclip mode in the debug*/ || checkPass(dir, map)) {
-                    justTP = false;
-                    movement = true;
-                    switch(dir) {
-                    case Side::TO_UP:
-                        posY--;
-                        break;
-                    case Side::TO_DOWN:
-                        posY++;
-                        break;
-                    case Side::TO_LEFT:
-                        posX--;
-                        break;
-                    case Side::TO_RIGHT:
-                        posX++;
-                        break;
-                    case Side::NO_MOVE:
-                        this->dir = Side::STAY;
-                        break;
-                    case Side::STAY:
-                        break;
-                    }
-                    return true;
+            if(anim || moveLock) {
+                return false;
+            }
+            return start(dir, (!event && debugCol) /*Noclip mode in the debug*/ || checkPass(dir, map));
+        }
+
+        bool Position::moveChecked(Side dir, Map *map, bool tileFree) {
+            if(anim || moveLock) {
+                return false;
+            }
+            return start(dir, tileFree && checkEntities(dir, map));
+        }
+
+        bool Position::start(Side dir, bool pass) {
+            this->dir = dir;
+
+            anim = true;
+
+            if(pass) {
+                justTP = false;
+                movement = true;
+                if(!event && dir != Side::NO_MOVE && dir != Side::STAY) {
+                    playerSteps.push(Step{sf::Vector2i(posX, posY), dir});
+                }
+                switch(dir) {
+                case Side::TO_UP:
+                    posY--;
+                    break;
+                case Side::TO_DOWN:
+                    posY++;
+                    break;
+                case Side::TO_LEFT:
+                    posX--;
+                    break;
+                case Side::TO_RIGHT:
+                    posX++;
+                    break;
+                case Side::NO_MOVE:
+                    this->dir = Side::STAY;
+                    break;
+                case Side::STAY:
+                    break;
                 }
+                return true;
             }
 
             return false;
@@ -88,62 +111,75 @@ namespace OpMon {
 
         Position *Position::playerPos = nullptr;
 
+        Utils::RingBuffer<Position::Step> Position::playerSteps(PLAYER_STEPS_SIZE);
+
         void Position::setPlayerPos(Position *pos) {
             if(playerPos == nullptr) {
                 playerPos = pos;
             }
         }
 
+        sf::Vector2i Position::getNext(Side direction) const {
+            switch(direction) {
+            case Side::TO_UP:
+                return sf::Vector2i(posX, posY - 1);
+            case Side::TO_DOWN:
+                return sf::Vector2i(posX, posY + 1);
+            case Side::TO_LEFT:
+                return sf::Vector2i(posX - 1, posY);
+            case Side::TO_RIGHT:
+                return sf::Vector2i(posX + 1, posY);
+            default:
+                return sf::Vector2i(posX, posY);
+            }
+        }
+
         bool Position::checkPass(Side direction, Map *map) {
+            return checkTile(direction, *map) && checkEntities(direction, map);
+        }
 
-            std::list<AbstractEvent *> nextEvents;
-            sf::Vector2i nextPos;
-            sf::Vector2i nextPosPix;
+        bool Position::checkTile(Side direction, Map const &map) const {
             int exclusiveCol = 0;
 
-            //Finds the next tile's position
             switch(direction) {
             case Side::TO_UP:
-                nextPos = sf::Vector2i(posX, posY - 1);
                 exclusiveCol = 8;
                 break;
             case Side::TO_DOWN:
-                nextPos = sf::Vector2i(posX, posY + 1);
                 exclusiveCol = 7;
                 break;
             case Side::TO_LEFT:
-                nextPos = sf::Vector2i(posX - 1, posY);
                 exclusiveCol = 6;
                 break;
             case Side::TO_RIGHT:
-                nextPos = sf::Vector2i(posX + 1, posY);
                 exclusiveCol = 5;
                 break;
             default:
                 return true;
-                break;
             }
 
-            nextPosPix = nextPos SQUARES;
-
-            if(nextPos.x >= 0 && nextPos.x < map->getW() && nextPos.y >= 0 && nextPos.y < map->getH()) { //Avoid checking in the void (Out of the map's bounds)
-                int colLayer1 = map->getTileCollision(map->getCurrentTileCode(nextPos, 1));
-                int colLayer2 = map->getTileCollision(map->getCurrentTileCode(nextPos, 2));
-                if((colLayer1 == 0 || colLayer1 == exclusiveCol) && (colLayer2 == 0 || colLayer2 == exclusiveCol)) {           //Checks if the next tile is passable
-                    if(event ? !(nextPos.y == playerPos->getPosition().y && nextPos.x == playerPos->getPosition().x) : true) { //Checks if the player is not in the way, but only if it's an event (A player can not interact with itself.)
-                        nextEvents = map->getEvent(nextPos);                                                                   //Searches the events at this position
-                        for(AbstractEvent *nextEvent : nextEvents) {
-                            if(!nextEvent->isPassable()) { //Checks if the event ahead of the player is passable
-                                return false;
-                            }
-                        }
-                        return true;
-                    }
-                }
+            //Finds the next tile's position
+            sf::Vector2i nextPos = getNext(direction);
+
+            if(nextPos.x >= 0 && nextPos.x < map.getW() && nextPos.y >= 0 && nextPos.y < map.getH()) { //Avoid checking in the void (Out of the map's bounds)
+                int colLayer1 = map.getTileCollision(map.getCurrentTileCode(nextPos, 1));
+                int colLayer2 = map.getTileCollision(map.getCurrentTileCode(nextPos, 2));
+                return (colLayer1 == 0 || colLayer1 == exclusiveCol) && (colLayer2 == 0 || colLayer2 == exclusiveCol); //Checks if the next tile is passable
             }
 
             return false;
         }
 
+        bool Position::checkEntities(Side direction, Map *map) const {
+            sf::Vector2i nextPos = getNext(direction);
+            if(nextPos == sf::Vector2i(posX, posY)) {
+                return true;
+            }
+            if(event && nextPos == playerPos->getPosition()) { //Checks if the player is not in the way, but only if it's an event (A player can not interact with itself.)
+                return false;
+            }
+            return !map->getEventStore().isBlocking(nextPos); //Checks if an event ahead of the entity is not passable
+        }
+
     } // namespace Elements
 } // namespace OpMon
@@ -14,6 +14,7 @@
 #include <string>
 
 #include "../../model/Enums.hpp"
+#include "../../../utils/RingBuffer.hpp"
 
 /*!
  * \brief The size of one tile, in pixels.
@@ -34,6 +35,17 @@ namespace OpMon {
          */
         class Position {
           public:
+            /*!
+             * \brief A step of the player, kept in the history returned by getPlayerSteps().
+             */
+            struct Step {
+                /*!
+                 * \brief The tile the player has left.
+                 */
+                sf::Vector2i from;
+                Side dir;
+            };
+
             /*!
              * \brief Constructs a Position object with default position data.
              * \param event If `true`, the position is for an event. Else, it's for the player.
@@ -116,6 +128,7 @@ namespace OpMon {
 
             /*!
              * \brief Teleports the entity in a new position.
+             * \details If the entity is the player, its last steps (see getPlayerSteps()) are forgotten.
              */
             void tp(sf::Vector2i position);
 
@@ -128,12 +141,34 @@ namespace OpMon {
              * \return `false` if the entity can't move, `true` if the movement has been initiated.
              */
             bool move(Side dir, Map *map, bool debugCol = false);
+            /*!
+             * \brief Moves the entity, the tiles of the map having already been checked with checkTile().
+             * \details Only checks the player and the events. If the map blocks the entity, it turns without moving, as with move().
+             * \param tileFree The result of checkTile() for this direction.
+             * \return `false` if the entity can't move, `true` if the movement has been initiated.
+             */
+            bool moveChecked(Side dir, Map *map, bool tileFree);
+
+            /*!
+             * \brief Checks if the tiles of the map let the entity go through an adjacent tile.
+             * \details The player and the events are not checked : this method only reads the map, so it can be called in parallel for several entities.
+             * \return `true` if the map lets the entity go, or if `dir` is not a direction.
+             */
+            bool checkTile(Side dir, Map const &map) const;
 
             /*!
              * \brief Sets the position of Position::playerPos
              */
             static void setPlayerPos(Position *pos);
 
+            /*!
+             * \brief Returns the last steps of the player, recorded by move().
+             * \details The npcs following the player replay these steps, and the history can be used to debug the movements.
+             */
+            static const Utils::RingBuffer<Step> &getPlayerSteps() {
+                return playerSteps;
+            }
+
 
             /*!
              * \brief Indicates if the player has just been teleported between two maps.
@@ -146,12 +181,29 @@ namespace OpMon {
              * \return `true` if the entity can, `false` otherwise.
              */
             bool checkPass(Side dir, Map *map);
+            /*!
+             * \brief Checks if the player or a non passable event is in the way.
+             */
+            bool checkEntities(Side dir, Map *map) const;
+            /*!
+             * \brief Starts a movement, once move() has checked if the entity can go.
+             */
+            bool start(Side dir, bool pass);
+            /*!
+             * \brief Returns the tile next to the entity in the given direction, or its own tile if `dir` is not a direction.
+             */
+            sf::Vector2i getNext(Side dir) const;
 
             /*!
              * \brief A pointer to the player's position.
              */
             static Position *playerPos;
 
+            /*!
+             * \brief The last steps of the player.
+             */
+            static Utils::RingBuffer<Step> playerSteps;
+
             int posX = 0;
             int posY = 0;
             /*!
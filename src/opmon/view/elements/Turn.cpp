@@ -5,29 +5,85 @@ File under GNU GPL v3.0 license
 */
 #include "Turn.hpp"
 
-#include "src/utils/OpString.hpp"
-
 namespace OpMon {
     namespace Elements {
         void newTurnAction(TurnAction *toNew) {
-            toNew->hpLost = 0;
-            toNew->dialog = Utils::OpString();
             toNew->type = TurnActionType::NOTHING;
-            toNew->statCoef = 0;
+            toNew->message = BattleMessage::NONE;
+            toNew->side = 0;
+            toNew->value = 0;
+            toNew->extra = 0;
         }
 
         void newTurnData(TurnData *toNew) {
             toNew->opmon = nullptr;
             toNew->moveUsed = nullptr;
+            toNew->moveSlot = 0;
             toNew->type = TurnType::MOVE;
             toNew->itemUsed = nullptr;
         }
 
-        TurnAction createTurnDialogAction(Utils::OpString dialog) {
+        char const *getMessageKey(BattleMessage message) {
+            //In the order of BattleMessage
+            static char const *const keys[] = {"void",
+                                               "battle.dialog.move",
+                                               "battle.dialog.fail",
+                                               "battle.effectiveness.none",
+                                               "battle.effectiveness.almostnone",
+                                               "battle.effectiveness.notvery",
+                                               "battle.effectiveness.very",
+                                               "battle.effectiveness.super",
+                                               "battle.status.frozen.out",
+                                               "battle.status.frozen.move",
+                                               "battle.status.sleep.out",
+                                               "battle.status.sleep.move",
+                                               "battle.status.paralysed.move.fail",
+                                               "battle.status.paralysed.move.success",
+                                               "battle.status.confused.out",
+                                               "battle.status.confused.move.fail",
+                                               "battle.status.confused.move.success",
+                                               "battle.status.afraid",
+                                               "battle.status.burning.in",
+                                               "battle.status.paralysed.in",
+                                               "battle.status.sleep.in",
+                                               "battle.status.frozen.in",
+                                               "battle.status.poisoned.in",
+                                               "battle.status.confused.in",
+                                               "battle.dialog.heal",
+                                               "battle.dialog.hits"};
+            return keys[(int)message];
+        }
+
+        char const *getMessageFallback(BattleMessage message) {
+            switch(message) {
+            case BattleMessage::STATUS_BURNING:
+                return "~ is burnt!";
+            case BattleMessage::STATUS_PARALYSED:
+                return "~ is paralysed!";
+            case BattleMessage::STATUS_SLEEPING:
+                return "~ falls asleep!";
+            case BattleMessage::STATUS_FROZEN:
+                return "~ is frozen!";
+            case BattleMessage::STATUS_POISONED:
+                return "~ is poisoned!";
+            case BattleMessage::CONFUSED:
+                return "~ becomes confused!";
+            case BattleMessage::HEALED:
+                return "~ gets HP back!";
+            case BattleMessage::HITS:
+                return "Hit ~ times!";
+            default:
+                return nullptr;
+            }
+        }
+
+        TurnAction createTurnDialogAction(BattleMessage message, int side, int move) {
             TurnAction ta;
             newTurnAction(&ta);
             ta.type = TurnActionType::DIALOG;
-            ta.dialog = dialog;
+            ta.message = message;
+            ta.side = side;
+            ta.value = move;
             return ta;
         }
 
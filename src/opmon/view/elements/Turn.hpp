@@ -7,7 +7,9 @@
 */
 #pragma once
 
+#include <cstdint>
 #include <map>
+#include <type_traits>
 
 #include "../../model/Item.hpp"
 
@@ -56,23 +58,75 @@ class Item;
             NEXT = 19    /*!< This is now the turn of the next OpMon.*/
         };
 
+        /*!
+         * \brief Enumerates the dialogs which can be printed during a turn.
+         * \details Each message is a key of the StringKeys (see getMessageKey()). The `~` in the strings are completed with the nickname of the OpMon
+         * of TurnAction::side, and then with the name of its move in the slot TurnAction::value.
+         */
+        enum class BattleMessage : std::uint8_t {
+            NONE, /*!< No dialog.*/
+            MOVE, /*!< The OpMon uses a move.*/
+            FAIL, /*!< The move fails.*/
+            NO_EFFECT, /*!< The move has no effect.*/
+            ALMOST_NO_EFFECT, /*!< The move is almost not effective.*/
+            NOT_VERY_EFFECTIVE, /*!< The move is not very effective.*/
+            VERY_EFFECTIVE, /*!< The move is very effective.*/
+            SUPER_EFFECTIVE, /*!< The move is super effective.*/
+            FROZEN_OUT, /*!< The OpMon is not frozen anymore.*/
+            FROZEN, /*!< The OpMon is frozen.*/
+            SLEEP_OUT, /*!< The OpMon wakes up.*/
+            SLEEP, /*!< The OpMon is sleeping.*/
+            PARALYSED_FAIL, /*!< The OpMon can't move because of its paralysis.*/
+            PARALYSED_SUCCESS, /*!< The OpMon moves despite its paralysis.*/
+            CONFUSED_OUT, /*!< The OpMon is not confused anymore.*/
+            CONFUSED_FAIL, /*!< The OpMon hurts itself in its confusion.*/
+            CONFUSED_SUCCESS, /*!< The OpMon moves despite its confusion.*/
+            AFRAID, /*!< The OpMon is afraid.*/
+            STATUS_BURNING, /*!< The OpMon is burnt. The status messages are in the order of Status.*/
+            STATUS_PARALYSED, /*!< The OpMon is paralysed.*/
+            STATUS_SLEEPING, /*!< The OpMon falls asleep.*/
+            STATUS_FROZEN, /*!< The OpMon is frozen.*/
+            STATUS_POISONED, /*!< The OpMon is poisoned.*/
+            CONFUSED, /*!< The OpMon becomes confused.*/
+            HEALED, /*!< The OpMon gets HP back.*/
+            HITS /*!< The move hits several times, TurnAction::value being the number of hits.*/
+        };
+
+        /*!
+         * \brief Returns the key of the string of a message.
+         */
+        char const *getMessageKey(BattleMessage message);
+        /*!
+         * \brief Returns the English text of a message, used if its key is not in the keys files yet, or `nullptr` if the key always exists.
+         * \details As in the keys files, each `~` is replaced by an object of the message.
+         */
+        char const *getMessageFallback(BattleMessage message);
+
         /*!
          * \brief Contains data needed to show an action in a turn in a View::Battle.
          * \details TurnAction is like a command sent to View::Battle : according to what's inside, View::Battle will act differently. TurnAction::type is like the command itself, and the other variables the arguments. You do not have to use every variable, some are useless according to the type of action you choose.
+         *
+         * The dialogs are only stored as a BattleMessage and its arguments : the string is made by View::Battle when the dialog is printed, so creating an action never allocates memory.
          */
         struct TurnAction {
-            int hpLost;/*!< \brief The HP lost by the OpMon.*/
-            Utils::OpString dialog;/*!< \brief The dialog to be printed.*/
             TurnActionType type; /*!< \brief The type of the turn action.*/
-            int statCoef; /*!< \brief The coefficient of modification of the modified stat.*/
-            Stats statMod; /*!< \brief The modified stat.*/
+            BattleMessage message; /*!< \brief The dialog to be printed, if `type` is TurnActionType::DIALOG.*/
+            std::uint8_t side; /*!< \brief The OpMon concerned by the action, 0 being the player's and 1 the opponent's.*/
+            std::int16_t value; /*!< \brief The HP lost by the OpMon, the modified stat or the slot of the move named in the dialog.*/
+            std::int16_t extra; /*!< \brief The coefficient of modification of the modified stat.*/
         };
 
+        static_assert(std::is_trivially_copyable_v<TurnAction>, "The turn actions are copied in a buffer allocated once.");
+
         /*!
          * \brief Contains data needed to show a turn in View::Battle.
          */
         struct TurnData {
             Move *moveUsed;
+            /*!
+             * \brief The slot of \ref moveUsed in the moves of the OpMon.
+             */
+            int moveSlot;
             OpMon *opmon;
             TurnType type;
             Item *itemUsed;
@@ -95,9 +149,11 @@ class Item;
         void newTurnData(TurnData *toNew);
         /*!
          * \brief Shortcut to create TurnActions to show dialogs.
-         * \param dialog The dialog to show.
+         * \param message The dialog to show.
+         * \param side The OpMon named in the dialog.
+         * \param move The slot of the move named in the dialog, if any.
          * \returns The TurnAction printing the dialog in Battle::View.
          */
-        TurnAction createTurnDialogAction(Utils::OpString dialog);
+        TurnAction createTurnDialogAction(BattleMessage message, int side, int move = 0);
     } // namespace Elements
 } // namespace OpMon
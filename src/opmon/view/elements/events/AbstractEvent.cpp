@@ -1,7 +1,18 @@
 #include "AbstractEvent.hpp"
+#include "EventStore.hpp"
+
+#include <cstddef>
+
 #include "src/opmon/screens/overworld/Overworld.hpp"
 #include "src/utils/log.hpp"
 #include "src/utils/misc.hpp"
+#include "src/utils/Arena.hpp"
+
+/*!
+ * \brief The size of the header put before each event by AbstractEvent::operator new.
+ * \details The header contains a boolean telling if the event has been allocated in an arena. It is big enough to keep the event aligned.
+ */
+#define EVENT_HEADER_SIZE alignof(std::max_align_t)
 
 namespace OpMon {
 	namespace Elements {
@@ -12,7 +23,6 @@ namespace OpMon {
 		, mapPos(position, true)
 		, passable(passable)
 		, sides(sides)
-		, sprite(new sf::Sprite())
 		, currentTexture(otherTextures.begin()) {
 
 		}
@@ -24,19 +34,46 @@ namespace OpMon {
 		, mapPos((1.0f / 32.0f) * position, true)
 		, passable(jsonData.value("passable", true))
 		, sides(jsonData.value("side", SIDE_ALL))
-		, sprite(new sf::Sprite())
 		, currentTexture(otherTextures.begin()) {
 		}
 
-		void AbstractEvent::updateTexture() {
-			this->sprite->setPosition(position);
-			this->sprite->setTexture(*currentTexture);
+		void *AbstractEvent::operator new(std::size_t size) {
+			Utils::Arena *arena = Utils::Arena::current();
+			std::byte *memory = static_cast<std::byte *>(arena != nullptr ? arena->allocate(size + EVENT_HEADER_SIZE) : ::operator new(size + EVENT_HEADER_SIZE));
+			*reinterpret_cast<bool *>(memory) = arena != nullptr;
+			return memory + EVENT_HEADER_SIZE;
+		}
+
+		void AbstractEvent::operator delete(void *ptr) {
+			if(ptr == nullptr) return;
+			std::byte *memory = static_cast<std::byte *>(ptr) - EVENT_HEADER_SIZE;
+			if(!*reinterpret_cast<bool *>(memory)) {
+				::operator delete(memory);
+			}
+		}
+
+		void AbstractEvent::sync() {
+			if(store != nullptr) {
+				store->setMapPosition(slot, mapPos.getPosition(), mapPos.getDir());
+				store->setSprite(slot, position, currentTexture != otherTextures.end() ? &*currentTexture : nullptr);
+			}
+		}
+
+		void AbstractEvent::attach(EventStore &store, std::size_t slot) {
+			this->store = &store;
+			this->slot = slot;
+			store.setTransform(slot, origin, scale);
+			sync();
+		}
+
+		void AbstractEvent::detach() {
+			store = nullptr;
 		}
 
 		void AbstractEvent::setPosition(sf::Vector2i pos) {
 			position = 32.0f * sf::Vector2f(pos.x, pos.y);
 			mapPos.setPosition(pos.x, pos.y);
-			sprite->setPosition(position);
+			sync();
 		}
 	}
 }
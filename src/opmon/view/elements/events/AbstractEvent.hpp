@@ -8,7 +8,7 @@
 #pragma once
 
 #include <memory>
-#include <SFML/Graphics/Sprite.hpp>
+#include <SFML/Graphics/Texture.hpp>
 #include "src/opmon/core/Player.hpp"
 #include "src/nlohmann/json.hpp"
 
@@ -27,6 +27,9 @@ namespace OpMon{
 
 	namespace Elements {
 
+		class EventStore;
+		class Map;
+
 		/*!
 		 * \brief Defines the multiples way for an event to be triggered.
 		 * \ingroup Events
@@ -72,9 +75,13 @@ namespace OpMon{
 			sf::Vector2f position;
 
 			/*!
-			 * \brief The sprite of the event.
+			 * \brief The origin of the event's sprite.
+			 */
+			sf::Vector2f origin;
+			/*!
+			 * \brief The scale of the event's sprite.
 			 */
-			sf::Sprite* sprite;
+			sf::Vector2f scale = sf::Vector2f(1, 1);
 			/*!
 			 * \brief The position of the even of the map.
 			 */
@@ -88,6 +95,22 @@ namespace OpMon{
 			 */
 			std::vector<sf::Texture>::iterator currentTexture;
 
+			/*!
+			 * \brief The store in which the event is drawn, or `nullptr` if the event is not attached to a slot.
+			 */
+			EventStore *store = nullptr;
+			/*!
+			 * \brief The slot of the event in \ref store.
+			 */
+			std::size_t slot = 0;
+
+			/*!
+			 * \brief Writes \ref position, \ref mapPos and \ref currentTexture into the slot of the event.
+			 *
+			 * This method has to be called each time one of these fields is modified. It does nothing if the event is not attached.
+			 */
+			void sync();
+
 		public:
 			/*!
 			 * \warning The parameter position represents the position in squares, unlike the field position which stores the position in pixels.
@@ -95,6 +118,16 @@ namespace OpMon{
 			AbstractEvent(std::vector<sf::Texture> &otherTextures, EventTrigger eventTrigger, sf::Vector2f const &position, int sides, bool passable);
 			AbstractEvent(OverworldData &data, nlohmann::json jsonData);
 			virtual ~AbstractEvent() = default;
+
+			/*!
+			 * \brief Allocates an event in the current Utils::Arena, or on the heap if there is no current arena.
+			 * \details This allows Map::loadMap to allocate all the events of a map, including the ones contained in meta events, in the map's arena.
+			 */
+			static void *operator new(std::size_t size);
+			/*!
+			 * \brief Frees an event allocated on the heap. The memory of the events allocated in an arena is freed with the arena.
+			 */
+			static void operator delete(void *ptr);
 			/*!
 			 * \brief Method called each frame.
 			 */
@@ -104,9 +137,30 @@ namespace OpMon{
 			 */
 			virtual void action(Player &player, Overworld &overworld) = 0;
 			/*!
-			 * \brief Updates \ref sprite with \ref currentTexture and \ref position.
+			 * \brief Prepares the next update, computing what can be computed without the other events.
+			 * \details Called before update, in parallel with the other events of the same frame (see OverworldCtrl::updateEvents) :
+			 * it may only read the tiles of the map and write the data of the event itself.
+			 */
+			virtual void prepare(Map const &) {}
+			/*!
+			 * \brief Method called when the player walks into the sight of an event triggered with EventTrigger::ZONE.
+			 * \details Calls action by default.
+			 */
+			virtual void seen(Player &player, Overworld &overworld) {action(player, overworld);}
+			/*!
+			 * \brief Method called when the event comes back in the activity region of the overworld.
+			 * \details While outside of this region, the event is not updated every frame. This method has to put it back in a state consistent with a normal update.
 			 */
-			virtual void updateTexture();
+			virtual void wake() {}
+			/*!
+			 * \brief Makes the event write its data into a slot of an EventStore.
+			 * \details The whole state of the event is written into the slot when this method is called.
+			 */
+			virtual void attach(EventStore &store, std::size_t slot);
+			/*!
+			 * \brief Stops writing the data of the event into its slot.
+			 */
+			virtual void detach();
 
 			int getSide() const {
 				return sides;
@@ -130,14 +184,21 @@ namespace OpMon{
 				return passable;
 			}
 
-			virtual const sf::Sprite *getSprite() const {
-				return sprite;
+			/*!
+			 * \brief Sets the origin of the event's sprite.
+			 * \details Has to be called before the event is attached to a slot.
+			 */
+			void setOrigin(sf::Vector2f const &origin) {
+				this->origin = origin;
 			}
 
 			/*!
 			 * \brief Sets the current texture to the first texture of \ref otherTextures.
 			 */
-			void resetTexture() {currentTexture = otherTextures.begin();}
+			void resetTexture() {
+				currentTexture = otherTextures.begin();
+				sync();
+			}
 
 			/*!
 			 * \brief If the activation of the event is over, returns true. If the event is still doing something, returns false.
@@ -149,14 +210,14 @@ namespace OpMon{
 			/*!
 			 * \brief Changes the position of the event.
 			 *
-			 * This method moves the event by changing \ref position, but also \ref mapPos and the position of the \ref sprite.
+			 * This method moves the event by changing \ref position, but also \ref mapPos and the event's slot.
 			 * The new position has to be in squares.
 			 */
 			virtual void setPosition(int x, int y) {setPosition(sf::Vector2i(x,y));}
 			/*!
              * \brief Changes the position of the event.
 			 *
-			 * This method moves the event by changing \ref position, but also \ref mapPos and the position of the \ref sprite.
+			 * This method moves the event by changing \ref position, but also \ref mapPos and the event's slot.
 			 * \param xy The new position, in squares.
 			 */
 			virtual void setPosition(sf::Vector2i pos);
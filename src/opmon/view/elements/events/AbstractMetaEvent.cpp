@@ -4,6 +4,7 @@
 #include "DialogEvent.hpp"
 #include "SoundEvent.hpp"
 #include "metaevents.hpp"
+#include "ScriptEvent.hpp"
 
 namespace OpMon::Elements {
 	AbstractMetaEvent::AbstractMetaEvent(std::queue<AbstractEvent*> eventQueue)
@@ -25,6 +26,7 @@ namespace OpMon::Elements {
 			else if(type == "TalkingCharacter") eventQueue.push(new TrainerEvent(data, event));
 			else if(type == "Door") eventQueue.push(new DoorEvent(data, event));
 			else if(type == "LinearMeta") eventQueue.push(new LinearMetaEvent(data, event));
+			else if(type == "Script") eventQueue.push(new ScriptEvent(data, event));
 			else if(type == "nullptr") eventQueue.push(nullptr);
 		}
 		mainEvent = eventQueue.front();
@@ -42,6 +44,25 @@ namespace OpMon::Elements {
 		mapPos = mainEvent->getPositionMap();
 	}
 
+	void AbstractMetaEvent::attach(EventStore &store, std::size_t slot){
+		metaStore = &store;
+		metaSlot = slot;
+		mainEvent->attach(store, slot);
+	}
+
+	void AbstractMetaEvent::detach(){
+		metaStore = nullptr;
+		mainEvent->detach();
+	}
+
+	void AbstractMetaEvent::setMainEvent(AbstractEvent *event){
+		if(metaStore != nullptr){
+			mainEvent->detach();
+			event->attach(*metaStore, metaSlot);
+		}
+		mainEvent = event;
+	}
+
 	void AbstractMetaEvent::setPosition(sf::Vector2i pos){
 		mainEvent->setPosition(pos);
 		AbstractEvent::setPosition(pos);
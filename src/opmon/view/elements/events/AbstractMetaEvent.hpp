@@ -50,6 +50,20 @@ namespace OpMon{
              */
             AbstractEvent* mainEvent;
 
+            /*!
+             * \brief The store in which \ref mainEvent is drawn, or `nullptr` if the meta event is not attached.
+             */
+            EventStore *metaStore = nullptr;
+            /*!
+             * \brief The slot of the meta event in \ref metaStore.
+             */
+            std::size_t metaSlot = 0;
+
+            /*!
+             * \brief Changes \ref mainEvent, moving the slot of the meta event to the new main event.
+             */
+            void setMainEvent(AbstractEvent *event);
+
         public:
             AbstractMetaEvent(std::queue<AbstractEvent*> eventQueue);
             AbstractMetaEvent(OverworldData &data, nlohmann::json jsonData);
@@ -57,23 +71,26 @@ namespace OpMon{
             virtual void update(Player &player, Overworld &overworld);
             virtual bool isOver() const {return !processing;}
             virtual ~AbstractMetaEvent();
-            /*!
-             * \brief Returns the sprite of \ref mainEvent.
-             */
-            virtual const sf::Sprite* getSprite() const {return mainEvent->getSprite();}
             /*!
              * \brief Returns the texture of \ref mainEvent.
              */
             virtual const sf::Texture &getTexture() {return mainEvent->getTexture();}
+            virtual void wake() {mainEvent->wake();}
+            virtual void prepare(Map const &map) {mainEvent->prepare(map);}
+            /*!
+             * \brief Attaches \ref mainEvent to the slot.
+             * \details The meta event doesn't write into the slot itself : its main event does it.
+             */
+            virtual void attach(EventStore &store, std::size_t slot);
             /*!
-             * \brief Updates the texture of \ref mainEvent.
+             * \brief Detaches \ref mainEvent from the slot.
              */
-            virtual void updateTexture() {mainEvent->updateTexture();}
+            virtual void detach();
 
             /*!
              * \brief Changes the position of the event.
              *
-             * This method moves the event by changing \ref position, but also \ref mapPos and the position of the \ref sprite.
+             * This method moves the event by changing \ref position, but also \ref mapPos and the position of \ref mainEvent.
              * The new position has to be in squares.
              */
             virtual void setPosition(int x, int y) {setPosition(sf::Vector2i(x,y));}
@@ -81,7 +98,7 @@ namespace OpMon{
             /*!
              * \brief Changes the position of the event.
              *
-             * This method moves the event by changing \ref position, but also \ref mapPos and the position of the \ref sprite.
+             * This method moves the event by changing \ref position, but also \ref mapPos and the position of \ref mainEvent.
              * \param xy The new position, in squares.
              */
              virtual void setPosition(sf::Vector2i pos);
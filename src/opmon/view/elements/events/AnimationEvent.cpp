@@ -33,6 +33,7 @@ namespace OpMon {
 					playing = loop; //If loop, continue playing, else, stop.
 					if(!playing && lastTexture) currentTexture = otherTextures.end() - 1;
 				}
+				sync();
 			}else if(playing && (framecount < framerate)){
 				framecount++;
 			}
@@ -11,7 +11,9 @@ namespace OpMon {
 
 		BattleEvent::BattleEvent(OverworldData &data, nlohmann::json jsonData)
 		: AbstractEvent(data, jsonData)
-		, team(data.getTrainer(jsonData.at("trainer"))){
+		, team(data.getTrainer(jsonData.at("trainer")))
+		, aiLevel(jsonData.value("aiLevel", AI_DEFAULT_LEVEL))
+		, aiBudget(jsonData.value("aiBudget", AI_DEFAULT_BUDGET)){
 
 		}
 
@@ -7,6 +7,8 @@
 #pragma once
 
 #include "AbstractEvent.hpp"
+#include "src/opmon/core/Sequence.hpp"
+#include "src/opmon/model/BattleAI.hpp"
 
 namespace OpMon::Elements {
 	/*!
@@ -24,6 +26,19 @@ namespace OpMon::Elements {
 		 * \brief If the battle is over or has not begun.
 		 */
 		bool over = true;
+
+		/*!
+		 * \brief Notified when the battle ends.
+		 */
+		Signal end;
+		/*!
+		 * \brief The level of the trainer's AI (see BattleAI).
+		 */
+		int aiLevel = AI_DEFAULT_LEVEL;
+		/*!
+		 * \brief The time given to the trainer's AI to choose an action, in milliseconds.
+		 */
+		int aiBudget = AI_DEFAULT_BUDGET;
 	public:
 		BattleEvent(std::vector<sf::Texture> &textures, sf::Vector2f const &position, OpTeam *team, EventTrigger eventTrigger = EventTrigger::PRESS, bool passable = false, int side = SIDE_ALL);
 		BattleEvent(OverworldData &data, nlohmann::json jsonData);
@@ -36,11 +51,21 @@ namespace OpMon::Elements {
 		}
 
 		bool isOver() const {return over;}
+		int getAILevel() const {return aiLevel;}
+		int getAIBudget() const {return aiBudget;}
 
 		/*!
 		 * \brief Sets over to true.
 		 */
-		void setOver() {over = true;}
+		void setOver() {
+			over = true;
+			end.notify();
+		}
+
+		/*!
+		 * \brief Returns a signal notified when the battle ends.
+		 */
+		Signal &getEnd() {return end;}
 
 		virtual ~BattleEvent();
 	};
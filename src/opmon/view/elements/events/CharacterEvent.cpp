@@ -9,9 +9,10 @@ namespace OpMon {
 				EventTrigger eventTrigger, std::vector<Side> predefinedPath, bool passable,
 				int sides)
 		: AbstractEvent(textures, eventTrigger, position, sides, passable)
-		, moveStyle(moveStyle) {
-			sprite->setScale(2, 2);
-			sprite->setOrigin(16, 16);
+		, moveStyle(moveStyle)
+		, randomEngine(Utils::Misc::getRNGEngine()()) {
+			scale = sf::Vector2f(2, 2);
+			origin = sf::Vector2f(16, 16);
 			this->position += sf::Vector2f(16, 0);
 			setPredefinedMove(predefinedPath);
 			mapPos.setDir(posDir);
@@ -19,9 +20,11 @@ namespace OpMon {
 
 		CharacterEvent::CharacterEvent(OverworldData &data, nlohmann::json jsonData)
 		: AbstractEvent(data, jsonData)
-		, moveStyle(jsonData.value("moveStyle", MoveStyle::NO_MOVE)){
-			sprite->setScale(2, 2);
-			sprite->setOrigin(16, 16);
+		, moveStyle(jsonData.value("moveStyle", MoveStyle::NO_MOVE))
+		, followLag(jsonData.value("lag", 1))
+		, randomEngine(Utils::Misc::getRNGEngine()()){
+			scale = sf::Vector2f(2, 2);
+			origin = sf::Vector2f(16, 16);
 			this->position += sf::Vector2f(16, 0);
 			std::vector<std::vector<int>> prePath = jsonData.value("path", std::vector<std::vector<int>>());
 			std::vector<Side> charaPath;
@@ -37,63 +40,101 @@ namespace OpMon {
 			mapPos.setDir(jsonData.value("facing", Side::TO_DOWN));
 		}
 
-		void CharacterEvent::update(Player &player, Overworld &overworld) {
+		void CharacterEvent::prepare(Map const &map) {
+			prepared = true;
 			frames++;
-			if(!mapPos.isAnim()) { //Checks if not already moving
-				int randomMove;
+			animated = mapPos.isAnim();
+			planned = false;
+			if(animated) {
+				animate();
+				return;
+			}
+			switch(moveStyle) {
+			case MoveStyle::PREDEFINED: //Movement predefined during the npc's initialization
+				if(!movements.empty()) {
+					//TODO : Add the possibility of disabling the loop, for one-time movements
+					plannedMove = movements[(predefinedCounter + 1) % movements.size()];
+					planned = true;
+				}
+				break;
+
+			case MoveStyle::RANDOM: { //I don't think I will be using this often, but I keep it here, who knows?
+				//In the order of drawMove
+				static const Side randomSides[] = {Side::NO_MOVE, Side::TO_UP, Side::TO_DOWN, Side::TO_LEFT, Side::TO_RIGHT};
+				plannedMove = randomSides[drawMove() + 1];
+				planned = true;
+				break;
+			}
+
+			default: //NO_MOVE does nothing, and FOLLOWING uses the pathfinder of the map, which is updated during the serial part of the update.
+				break;
+			}
+			plannedFree = planned && mapPos.checkTile(plannedMove, map);
+		}
+
+		void CharacterEvent::update(Player &player, Overworld &overworld) {
+			Map *map = overworld.getData().getCurrentMap();
+			if(!prepared) {
+				prepare(*map);
+			}
+			prepared = false;
+
+			if(!animated && !mapPos.isAnim()) { //Checks if not already moving
 				switch(moveStyle) {
-				case MoveStyle::PREDEFINED: //Movement predefined during the npc's initialization
-					predefinedCounter++;
-					if(predefinedCounter >= movements.size()) { //TODO : Add the possibility of disabling the loop, for one-time movements
-						predefinedCounter = 0;
+				case MoveStyle::PREDEFINED:
+					//If the movement is impossible, the counter isn't increased, so the movement is tried again.
+					if(planned && moveChecked(plannedMove, map, plannedFree)) {
+						predefinedCounter = (predefinedCounter + 1) % movements.size();
 					}
+					break;
 
-					if(!move(movements[predefinedCounter], overworld.getData().getCurrentMap())) { //If the movement is impossible, decreases the counter to not ignore the movement.
-						if(predefinedCounter != 0) {
-							predefinedCounter--;
-						} else {
-							predefinedCounter = movements.size() - 1;
-						}
+				case MoveStyle::RANDOM:
+					if(planned) {
+						moveChecked(plannedMove, map, plannedFree);
 					}
 					break;
 
-				case MoveStyle::NO_MOVE: //This is easy to do.
+				case MoveStyle::FOLLOWING:
+					follow(map);
 					break;
 
-				case MoveStyle::RANDOM: //I don't think I will be using this often, but I keep it here, who knows?
-					randomMove = Utils::Misc::randUI(5) - 1;
-					try {
-						switch(randomMove) {
-						case -1:
-							move(Side::NO_MOVE, overworld.getData().getCurrentMap());
-							break;
-						case 0:
-							move(Side::TO_UP, overworld.getData().getCurrentMap());
-							break;
-						case 1:
-							move(Side::TO_DOWN, overworld.getData().getCurrentMap());
-							break;
-						case 2:
-							move(Side::TO_LEFT, overworld.getData().getCurrentMap());
-							break;
-						case 3:
-							move(Side::TO_RIGHT, overworld.getData().getCurrentMap());
-							break;
-						default:
-							throw Utils::UnexpectedValueException(std::to_string(randomMove), "an integer in [-1,3] representing a random movement in CharacterEvent::update");
-						}
-					} catch(Utils::UnexpectedValueException &e){
-						if(e.fatal) throw;
-						Utils::Log::oplog(e.desc(), true);
-						move(Side::NO_MOVE, overworld.getData().getCurrentMap());
-					}
+				case MoveStyle::NO_MOVE: //This is easy to do.
 					break;
+				}
+			}
+			if(!animated) {
+				animate();
+			}
 
-				case MoveStyle::FOLLOWING:
-					//TODO
+			if(mapPos.isAnim() && frames - startFrames >= 7) {
+				mapPos.stopMove();
+				moveEnd.notify();
+			}
+			if(wantmove && !mapPos.isAnim()){
+				switch(player.getPosition().getDir()) { //Put the character's face in front of the player's one
+				case Side::TO_DOWN:
+					mapPos.setDir(Side::TO_UP);
+					break;
+				case Side::TO_UP:
+					mapPos.setDir(Side::TO_DOWN);
+					break;
+				case Side::TO_LEFT:
+					mapPos.setDir(Side::TO_RIGHT);
+					break;
+				case Side::TO_RIGHT:
+					mapPos.setDir(Side::TO_LEFT);
+					break;
+				default:
 					break;
 				}
+				//Put the correct texture to the NPC
+				currentTexture = getTextures().begin() + (int)mapPos.getDir();
+				wantmove = false;
 			}
+			sync();
+		}
+
+		void CharacterEvent::animate() {
 			//Changes the texture to print, handles the movement itself.
 			if(mapPos.isAnim() && !anims && mapPos.getDir() != Side::STAY) { //First part of the animation
 				currentTexture = otherTextures.begin() + ((int)mapPos.getDir() + 4);
@@ -134,33 +175,18 @@ namespace OpMon {
 				}
 				if(mapPos.isMoving())
 					position -= toMove;
-				if(frames - startFrames >= 7)
-					mapPos.stopMove();
-			}
-			if(wantmove && !mapPos.isAnim()){
-				switch(player.getPosition().getDir()) { //Put the character's face in front of the player's one
-				case Side::TO_DOWN:
-					mapPos.setDir(Side::TO_UP);
-					break;
-				case Side::TO_UP:
-					mapPos.setDir(Side::TO_DOWN);
-					break;
-				case Side::TO_LEFT:
-					mapPos.setDir(Side::TO_RIGHT);
-					break;
-				case Side::TO_RIGHT:
-					mapPos.setDir(Side::TO_LEFT);
-					break;
-				default:
-					break;
-				}
-				//Put the correct texture to the NPC
-				currentTexture = getTextures().begin() + (int)mapPos.getDir();
-				updateTexture();
-				wantmove = false;
 			}
 		}
 
+		bool CharacterEvent::moveChecked(Side direction, Map *map, bool tileFree) {
+			startFrames = frames;
+			return mapPos.moveChecked(direction, map, tileFree);
+		}
+
+		int CharacterEvent::drawMove() {
+			return (int)(randomEngine() % 5) - 1;
+		}
+
 		bool CharacterEvent::move(Side direction, Map *map) {
 			startFrames = frames;
 			return mapPos.move(direction, map);
@@ -170,6 +196,48 @@ namespace OpMon {
 			move(direction, overworld.getData().getCurrentMap());
 		}
 
+		void CharacterEvent::follow(Map *map) {
+			Utils::RingBuffer<Position::Step> const &steps = Position::getPlayerSteps();
+			sf::Vector2i tile = mapPos.getPosition();
+			//Finds back the npc on the tiles left by the player, the latest first.
+			if(!steps.contains(followIndex) || steps[followIndex].from != tile) {
+				followIndex = steps.getCount();
+				for(std::size_t i = steps.getCount(); i > 0 && steps.contains(i - 1); i--) {
+					if(steps[i - 1].from == tile) {
+						followIndex = i - 1;
+						break;
+					}
+				}
+			}
+
+			if(followIndex < steps.getCount()) {
+				//The npc waits until the player is far enough.
+				if(followIndex + followLag < steps.getCount() && move(steps[followIndex].dir, map)) {
+					followIndex++;
+				}
+				return;
+			}
+
+			Pathfinder &pathfinder = map->getPathfinder();
+			if(pathfinder.getDistance(Pathfinder::PLAYER_TARGET, tile) > (int)followLag) {
+				Side dir = pathfinder.getDirection(Pathfinder::PLAYER_TARGET, tile);
+				if(dir != Side::NO_MOVE) {
+					move(dir, map);
+				}
+			}
+		}
+
+		void CharacterEvent::wake() {
+			if(mapPos.isAnim()) {
+				mapPos.stopMove();
+				moveEnd.notify();
+			}
+			anims = false;
+			animsCounter = 0;
+			position = 32.0f * sf::Vector2f(mapPos.getPosition()) + sf::Vector2f(16, 0);
+			sync();
+		}
+
 		void CharacterEvent::setPredefinedMove(std::vector<Side> moves) {
 			this->movements = moves;
 		}
@@ -177,6 +245,7 @@ namespace OpMon {
 		void CharacterEvent::setPosition(sf::Vector2i pos){
 			AbstractEvent::setPosition(pos);
 			this->position += sf::Vector2f(16, 0);
+			sync();
 		}
 
 	} /* namespace Elements */
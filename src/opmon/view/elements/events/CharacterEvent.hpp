@@ -6,7 +6,10 @@
 
 #pragma once
 
+#include <random>
+
 #include "AbstractEvent.hpp"
+#include "src/opmon/core/Sequence.hpp"
 
 namespace OpMon::Elements {
 
@@ -18,7 +21,7 @@ namespace OpMon::Elements {
 		NO_MOVE = 0,/*!< The npc has to stay still.*/
 		PREDEFINED = 1,/*!< The npc follows a predefined path.*/
 		RANDOM = 2,/*!< The npc moves randomly.*/
-		FOLLOWING = 3/*!< The npc follows the player (unimplemented yet).*/
+		FOLLOWING = 3/*!< The npc follows the player, replaying the steps of the player (see Position::getPlayerSteps).*/
 	};
 
 	/*!
@@ -65,9 +68,82 @@ namespace OpMon::Elements {
 		 */
 		bool wantmove = false;
 
+		/*!
+		 * \brief The number of steps between the npc and the player, for MoveStyle::FOLLOWING.
+		 */
+		unsigned int followLag = 1;
+		/*!
+		 * \brief The index of the next step of the player to replay, for MoveStyle::FOLLOWING.
+		 */
+		std::size_t followIndex = 0;
+
+		/*!
+		 * \brief The random generator of the npc, for MoveStyle::RANDOM.
+		 * \details Each npc has its own generator, so the movements of an npc don't depend on the other npcs.
+		 */
+		std::minstd_rand randomEngine;
+
+		/*!
+		 * \brief If prepare() has been called since the last update.
+		 */
+		bool prepared = false;
+		/*!
+		 * \brief If the npc was moving when prepare() was called. Its animation has then already been advanced by prepare().
+		 */
+		bool animated = false;
+		/*!
+		 * \brief If prepare() has chosen a movement, for MoveStyle::PREDEFINED and MoveStyle::RANDOM.
+		 */
+		bool planned = false;
+		/*!
+		 * \brief The movement chosen by prepare().
+		 */
+		Side plannedMove = Side::NO_MOVE;
+		/*!
+		 * \brief If the tiles of the map let the npc do \ref plannedMove (see Position::checkTile).
+		 */
+		bool plannedFree = false;
+
+		/*!
+		 * \brief Notified each time the npc ends a movement.
+		 */
+		Signal moveEnd;
+
+		/*!
+		 * \brief Draws a random movement, between -1 (no movement) and 3.
+		 */
+		int drawMove();
+
+		/*!
+		 * \brief Makes the npc take the next step following the player.
+		 * \details The npc replays the steps of the player, staying \ref followLag steps behind. If the npc is not on the tiles left by the player (when it starts following the player,
+		 * or if it has been left too far behind), it goes towards the player with the Pathfinder until it reaches them.
+		 */
+		void follow(Map *map);
+
+		/*!
+		 * \brief Changes the texture and the position of the sprite according to the current movement.
+		 */
+		void animate();
+
+		/*!
+		 * \brief Moves the npc, the tiles of the map having already been checked by prepare().
+		 */
+		bool moveChecked(Side direction, Map *map, bool tileFree);
+
 	public:
 		CharacterEvent(std::vector<sf::Texture> &textures, sf::Vector2f const &position, Side posDir = Side::TO_UP, MoveStyle moveStyle = MoveStyle::NO_MOVE, EventTrigger eventTrigger = EventTrigger::PRESS, std::vector<Side> predefinedPath = std::vector<Side>(), bool passable = false, int sides = SIDE_ALL);
 		CharacterEvent(OverworldData &data, nlohmann::json jsonData);
+		/*!
+		 * \brief Chooses the next movement of the npc and advances its animation.
+		 * \details Only reads the tiles of the map and the data of the npc, so it is called in parallel for the npcs (see OverworldCtrl::updateEvents).
+		 * The movement is done in update, where the other events and the player are checked.
+		 */
+		virtual void prepare(Map const &map);
+		/*!
+		 * \brief Does the movement chosen by prepare(), and everything depending on the other events.
+		 * \details Calls prepare() first if it hasn't been called since the last update.
+		 */
 		virtual void update(Player &player, Overworld &overworld);
 		virtual void action(Player &, Overworld &){wantmove = true;}
 		/*!
@@ -86,10 +162,20 @@ namespace OpMon::Elements {
 
 		bool isOver() const {return !wantmove;}
 
+		/*!
+		 * \brief Returns a signal notified each time the npc ends a movement.
+		 */
+		Signal &getMoveEnd() {return moveEnd;}
+
+		/*!
+		 * \brief Ends the current movement, which has been slowed down while the npc was inactive, and puts the npc on its tile.
+		 */
+		virtual void wake();
+
 		/*!
 		 * \brief Changes the position of the event.
 		 *
-		 * This method moves the event by changing \ref position, but also \ref mapPos and the position of the \ref sprite.
+		 * This method moves the event by changing \ref position, but also \ref mapPos and the event's slot.
 		 * The new position has to be in squares.
 		 */
 		virtual void setPosition(int x, int y) {setPosition(sf::Vector2i(x,y));}
@@ -97,7 +183,7 @@ namespace OpMon::Elements {
 		/*!
 		 * \brief Changes the position of the event.
 		 *
-		 * This method moves the event by changing \ref position, but also \ref mapPos and the position of the \ref sprite.
+		 * This method moves the event by changing \ref position, but also \ref mapPos and the event's slot.
 		 * \param xy The new position, in squares.
 		 */
 		virtual void setPosition(sf::Vector2i pos);
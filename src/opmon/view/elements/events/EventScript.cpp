@@ -0,0 +1,154 @@
+#include "EventScript.hpp"
+
+#include <algorithm>
+#include <limits>
+
+#include "BattleEvent.hpp"
+#include "src/opmon/screens/overworld/OverworldData.hpp"
+#include "src/opmon/core/GameData.hpp"
+#include "src/utils/exceptions.hpp"
+
+namespace OpMon::Elements {
+
+	namespace {
+
+		/*!
+		 * \brief The greatest value of an operand of a ScriptInstruction.
+		 */
+		constexpr int OPERAND_MAX = std::numeric_limits<std::int16_t>::max();
+		constexpr int OPERAND_MIN = std::numeric_limits<std::int16_t>::min();
+
+		/*!
+		 * \brief Checks a value read from a step, which has to be in [min, max].
+		 * \throws Utils::UnexpectedValueException if the value is out of range, so a wrong script can't read out of the textures of its event or overflow an operand.
+		 */
+		int checkOperand(nlohmann::json const &step, std::string const &key, long long value, int min, int max) {
+			if(value < min || value > max) {
+				throw Utils::UnexpectedValueException(std::to_string(value), key + " between " + std::to_string(min) + " and " + std::to_string(max) + " in the \"" + step.at("op").get<std::string>() + "\" step of an event script");
+			}
+			return (int)value;
+		}
+
+		int readOperand(nlohmann::json const &step, char const *key, int min, int max) {
+			return checkOperand(step, key, step.at(key).get<long long>(), min, max);
+		}
+
+		/*!
+		 * \brief Reads an optional operand of a step, `byDefault` if the step doesn't have it.
+		 */
+		int readOperand(nlohmann::json const &step, char const *key, int min, int max, int byDefault) {
+			return step.contains(key) ? readOperand(step, key, min, max) : byDefault;
+		}
+	}
+
+	EventScript::EventScript(OverworldData &data, nlohmann::json const &steps, std::vector<sf::Texture> &textures) {
+		compile(data, steps, textures);
+		emit(ScriptOp::END);
+	}
+
+	EventScript::~EventScript() {
+		for(BattleEvent *battle : battles) {
+			delete(battle);
+		}
+	}
+
+	std::int16_t EventScript::toOperand(long long value) {
+		if(value < OPERAND_MIN || value > OPERAND_MAX) {
+			throw Utils::UnexpectedValueException(std::to_string(value), "an operand between " + std::to_string(OPERAND_MIN) + " and " + std::to_string(OPERAND_MAX) + " in an event script (the script may be too long)");
+		}
+		return (std::int16_t)value;
+	}
+
+	void EventScript::emit(ScriptOp op, long long a, long long b, long long c) {
+		code.push_back(ScriptInstruction{op, toOperand(a), toOperand(b), toOperand(c)});
+	}
+
+	void EventScript::checkTiles(sf::Vector2i const &mapSize) const {
+		for(ScriptInstruction const &instruction : code) {
+			if(instruction.op == ScriptOp::WALK && (instruction.a >= mapSize.x || instruction.b >= mapSize.y)) {
+				throw Utils::UnexpectedValueException("[" + std::to_string(instruction.a) + ", " + std::to_string(instruction.b) + "]", "a tile of the map (" + std::to_string(mapSize.x) + "x" + std::to_string(mapSize.y) + ") as the destination of a \"walk\" step");
+			}
+		}
+	}
+
+	std::int16_t EventScript::compileLoad(OverworldData &data, nlohmann::json const &step) {
+		if(step.contains("register")) {
+			int reg = step.at("register");
+			if(reg < 0 || reg >= SCRIPT_REGISTERS) {
+				throw Utils::UnexpectedValueException(std::to_string(reg), "a register between 0 and " + std::to_string(SCRIPT_REGISTERS - 1) + " in an event script");
+			}
+			return reg;
+		}
+		emit(ScriptOp::LOAD_FLAG, 0, data.getFlagId(step.at("flag")));
+		return 0;
+	}
+
+	void EventScript::compileStore(OverworldData &data, nlohmann::json const &step) {
+		if(!step.contains("register")) {
+			emit(ScriptOp::STORE_FLAG, 0, data.getFlagId(step.at("flag")));
+		}
+	}
+
+	void EventScript::compile(OverworldData &data, nlohmann::json const &steps, std::vector<sf::Texture> &textures) {
+		for(nlohmann::json const &step : steps) {
+			std::string op = step.at("op");
+			if(op == "dialog") {
+				std::vector<std::string> keys = step.at("dialog");
+				std::vector<sf::String *> completions;
+				for(unsigned int i = 1; i < keys.size(); i++) {
+					completions.push_back(data.getCompletion(keys[i]));
+				}
+				dialogs.push_back(Utils::OpString(data.getGameDataPtr()->getStringKeys(), keys[0], completions));
+				emit(ScriptOp::DIALOG, dialogs.size() - 1);
+			} else if(op == "move") {
+				emit(ScriptOp::MOVE, readOperand(step, "side", (int)Side::TO_DOWN, (int)Side::TO_UP), readOperand(step, "count", 0, OPERAND_MAX, 1));
+			} else if(op == "walk") {
+				//The size of the map is checked when the event is put on it (see checkTiles)
+				std::vector<long long> to = step.at("to");
+				if(to.size() != 2) {
+					throw Utils::UnexpectedValueException(std::to_string(to.size()) + " coordinates", "2 coordinates for the \"to\" of a \"walk\" step of an event script");
+				}
+				emit(ScriptOp::WALK, checkOperand(step, "to[0]", to[0], 0, OPERAND_MAX), checkOperand(step, "to[1]", to[1], 0, OPERAND_MAX));
+			} else if(op == "face") {
+				//The textures of the directions are the first ones of the event
+				emit(ScriptOp::FACE, readOperand(step, "side", (int)Side::TO_DOWN, std::min((int)Side::TO_UP, (int)textures.size() - 1)));
+			} else if(op == "sound" || op == "music") {
+				sounds.push_back(step.at("id").get<std::string>());
+				emit(op == "sound" ? ScriptOp::SOUND : ScriptOp::MUSIC, sounds.size() - 1);
+			} else if(op == "animate") {
+				int from = readOperand(step, "from", 0, (int)textures.size() - 1);
+				emit(ScriptOp::ANIMATE, from, readOperand(step, "to", from, (int)textures.size() - 1), readOperand(step, "rate", 1, OPERAND_MAX, 1));
+			} else if(op == "wait") {
+				emit(ScriptOp::WAIT, 0, readOperand(step, "ticks", 0, OPERAND_MAX));
+			} else if(op == "teleport") {
+				teleports.push_back(ScriptTeleport{step.at("map").get<std::string>(), sf::Vector2i(step.at("position")[0], step.at("position")[1]), (Side)(step.contains("side") ? readOperand(step, "side", (int)Side::NO_MOVE, (int)Side::TO_UP) : (int)Side::NO_MOVE)});
+				emit(ScriptOp::TELEPORT, teleports.size() - 1);
+			} else if(op == "battle") {
+				battles.push_back(new BattleEvent(textures, sf::Vector2f(0, 0), data.getTrainer(step.at("trainer"))));
+				emit(ScriptOp::BATTLE, battles.size() - 1);
+			} else if(op == "set") {
+				std::int16_t reg = step.contains("register") ? compileLoad(data, step) : 0;
+				emit(ScriptOp::SET, reg, readOperand(step, "value", OPERAND_MIN, OPERAND_MAX));
+				compileStore(data, step);
+			} else if(op == "add") {
+				std::int16_t reg = compileLoad(data, step);
+				emit(ScriptOp::ADD, reg, readOperand(step, "value", OPERAND_MIN, OPERAND_MAX));
+				compileStore(data, step);
+			} else if(op == "if") {
+				std::int16_t reg = compileLoad(data, step);
+				std::size_t toElse = code.size();
+				emit(ScriptOp::JUMP_IF_ZERO, reg);
+				compile(data, step.value("then", nlohmann::json::array()), textures);
+				std::size_t toEnd = code.size();
+				emit(ScriptOp::JUMP);
+				code[toElse].b = toOperand(code.size());
+				compile(data, step.value("else", nlohmann::json::array()), textures);
+				code[toEnd].b = toOperand(code.size());
+			} else if(op == "end") {
+				emit(ScriptOp::END);
+			} else {
+				throw Utils::UnexpectedValueException(op, "a step of an event script (dialog, move, walk, face, sound, music, animate, wait, teleport, battle, set, add, if or end)");
+			}
+		}
+	}
+}
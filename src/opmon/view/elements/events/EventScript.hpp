@@ -0,0 +1,168 @@
+/*!
+ * \file EventScript.hpp
+ * \author Cyrielle
+ * \copyright GNU GPL v3.0
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+#include <SFML/Graphics/Texture.hpp>
+#include <SFML/System/Vector2.hpp>
+
+#include "src/nlohmann/json.hpp"
+#include "src/utils/OpString.hpp"
+#include "src/opmon/model/Enums.hpp"
+
+/*!
+ * \brief The number of registers of the script interpreter.
+ */
+#define SCRIPT_REGISTERS 8
+
+namespace OpMon {
+	class OverworldData;
+
+	namespace Elements {
+
+		class BattleEvent;
+
+		/*!
+		 * \brief The instructions of an EventScript.
+		 * \ingroup Events
+		 *
+		 * The operands `a`, `b` and `c` are the fields of ScriptInstruction. `r[a]` is the register with the index `a`.
+		 */
+		enum class ScriptOp : std::uint8_t {
+			END,/*!< Stops the script.*/
+			SET,/*!< `r[a] = b`*/
+			ADD,/*!< `r[a] += b`*/
+			LOAD_FLAG,/*!< `r[a] =` the flag with the index `b`.*/
+			STORE_FLAG,/*!< The flag with the index `b` `= r[a]`.*/
+			JUMP,/*!< Goes to the instruction `b`.*/
+			JUMP_IF_ZERO,/*!< Goes to the instruction `b` if `r[a] == 0`.*/
+			DIALOG,/*!< Shows the dialog `a` and waits for its end.*/
+			MOVE,/*!< Moves the event by `b` tiles in the direction `a` and waits for the end of the movement.*/
+			WALK,/*!< Moves the event to the tile (`a`, `b`) along the shortest path and waits for its arrival. Skipped if the tile can't be reached.*/
+			FACE,/*!< Turns the event in the direction `a`.*/
+			SOUND,/*!< Plays the sound `a`.*/
+			MUSIC,/*!< Plays the music `a`.*/
+			ANIMATE,/*!< Shows the textures of the event from `a` to `b`, each one during `c` frames, and waits for the end.*/
+			WAIT,/*!< Waits for `b` frames.*/
+			TELEPORT,/*!< Teleports the player to the destination `a`.*/
+			BATTLE/*!< Starts the battle `a` and waits for its end.*/
+		};
+
+		/*!
+		 * \brief One instruction of an EventScript.
+		 * \ingroup Events
+		 */
+		struct ScriptInstruction {
+			ScriptOp op;
+			std::int16_t a;
+			std::int16_t b;
+			std::int16_t c;
+		};
+
+		/*!
+		 * \brief A destination of the ScriptOp::TELEPORT instruction.
+		 * \ingroup Events
+		 */
+		struct ScriptTeleport {
+			std::string map;
+			sf::Vector2i position;
+			Side side;
+		};
+
+		/*!
+		 * \brief A script compiled from json, executed by ScriptEvent.
+		 * \ingroup Events
+		 *
+		 * A script is an array of steps. Each step is an object whose field "op" gives the action to do :
+		 * - `{"op": "dialog", "dialog": ["key", "completion"...]}`
+		 * - `{"op": "move", "side": 0, "count": 1}`, `{"op": "walk", "to": [0, 0]}` and `{"op": "face", "side": 0}`
+		 * - `{"op": "sound", "id": "id"}` and `{"op": "music", "id": "id"}`
+		 * - `{"op": "animate", "from": 0, "to": 3, "rate": 4}` and `{"op": "wait", "ticks": 30}`
+		 * - `{"op": "teleport", "map": "id", "position": [0, 0], "side": 0}`
+		 * - `{"op": "battle", "trainer": "name"}`
+		 * - `{"op": "set", "flag": "name", "value": 1}` and `{"op": "add", "flag": "name", "value": 1}`
+		 * - `{"op": "if", "flag": "name", "then": [steps], "else": [steps]}`, where "then" is executed if the flag is not 0.
+		 * - `{"op": "end"}`
+		 *
+		 * "set", "add" and "if" can use a "register" (between 0 and SCRIPT_REGISTERS - 1) instead of a "flag".
+		 * The steps are compiled into a flat array of ScriptInstruction, and the strings, destinations and battles are stored in pools referenced by index.
+		 */
+		class EventScript {
+		private:
+			std::vector<ScriptInstruction> code;
+			std::vector<Utils::OpString> dialogs;
+			std::vector<std::string> sounds;
+			std::vector<ScriptTeleport> teleports;
+			/*!
+			 * \brief The battles of the script. They are deleted with the script.
+			 */
+			std::vector<BattleEvent *> battles;
+
+			/*!
+			 * \brief Compiles an array of steps at the end of \ref code.
+			 * \throws Utils::UnexpectedValueException if a step is unknown or if one of its operands is out of range (a side which isn't a direction, a texture the event doesn't have,
+			 * or a value which doesn't fit in the operands of ScriptInstruction).
+			 */
+			void compile(OverworldData &data, nlohmann::json const &steps, std::vector<sf::Texture> &textures);
+			/*!
+			 * \brief Compiles the operand of a step that can use either a "flag" or a "register".
+			 * \details If the step uses a flag, the instruction loading it in the register 0 is added, and the register 0 is returned.
+			 * \returns The register containing the value.
+			 */
+			std::int16_t compileLoad(OverworldData &data, nlohmann::json const &step);
+			/*!
+			 * \brief If the step uses a flag, adds the instruction storing the register 0 in this flag.
+			 */
+			void compileStore(OverworldData &data, nlohmann::json const &step);
+			/*!
+			 * \brief Adds an instruction at the end of \ref code.
+			 * \throws Utils::UnexpectedValueException if an operand doesn't fit in a ScriptInstruction.
+			 */
+			void emit(ScriptOp op, long long a = 0, long long b = 0, long long c = 0);
+			/*!
+			 * \brief Converts a value to an operand of ScriptInstruction.
+			 * \throws Utils::UnexpectedValueException if the value doesn't fit, instead of letting it wrap around.
+			 */
+			static std::int16_t toOperand(long long value);
+
+		public:
+			/*!
+			 * \param data The overworld data, used to get the strings, the trainers and the flags.
+			 * \param steps The steps of the script.
+			 * \param textures The textures of the event executing the script, used by the battles and to check the "face" and "animate" steps.
+			 * \throws Utils::UnexpectedValueException if the script is invalid.
+			 */
+			EventScript(OverworldData &data, nlohmann::json const &steps, std::vector<sf::Texture> &textures);
+			EventScript(EventScript const &) = delete;
+			~EventScript();
+
+			/*!
+			 * \brief Checks that the destinations of the ScriptOp::WALK instructions are on the map of the event.
+			 * \throws Utils::UnexpectedValueException if a destination is outside of the map.
+			 */
+			void checkTiles(sf::Vector2i const &mapSize) const;
+
+			const std::vector<ScriptInstruction> &getCode() const {
+				return code;
+			}
+			const Utils::OpString &getDialog(std::size_t index) const {
+				return dialogs[index];
+			}
+			const std::string &getSound(std::size_t index) const {
+				return sounds[index];
+			}
+			const ScriptTeleport &getTeleport(std::size_t index) const {
+				return teleports[index];
+			}
+			BattleEvent *getBattle(std::size_t index) const {
+				return battles[index];
+			}
+		};
+	}
+}
@@ -0,0 +1,167 @@
+#include "EventStore.hpp"
+
+#include <algorithm>
+#include <array>
+
+/*!
+ * \brief The number of tiles seen in front of an event triggered with EventTrigger::ZONE.
+ */
+#define SIGHT_RANGE 6
+
+namespace OpMon::Elements {
+
+	namespace {
+		const std::vector<EventStore::Watcher> noWatchers;
+		const std::array<Side, 4> sightDirs = {Side::TO_UP, Side::TO_DOWN, Side::TO_LEFT, Side::TO_RIGHT};
+
+		sf::Vector2i sightStep(Side dir) {
+			switch(dir) {
+			case Side::TO_UP:
+				return sf::Vector2i(0, -1);
+			case Side::TO_DOWN:
+				return sf::Vector2i(0, 1);
+			case Side::TO_LEFT:
+				return sf::Vector2i(-1, 0);
+			default:
+				return sf::Vector2i(1, 0);
+			}
+		}
+	} // namespace
+
+	EventStore::~EventStore() {
+		for(AbstractEvent *event : events) {
+			delete(event);
+		}
+	}
+
+	void EventStore::setSize(sf::Vector2i const &size) {
+		mapSize = size;
+		tileMasks.assign(size.x * size.y, 0);
+		triggerCounts.assign(size.x * size.y * TRIGGER_MASK_BITS, 0);
+		blockers.assign(size.x * size.y, 0);
+		opaque.assign(size.x * size.y, false);
+		watchers.assign(size.x * size.y, std::vector<Watcher>());
+	}
+
+	void EventStore::setOpaque(std::vector<char> const &opaque) {
+		this->opaque = opaque;
+	}
+
+	std::size_t EventStore::add(AbstractEvent *event) {
+		std::size_t slot = events.size();
+		//Outside of the map, so the tile mask is updated when the event writes its position.
+		tiles.push_back(sf::Vector2i(-1, -1));
+		facing.push_back(Side::TO_DOWN);
+		triggers.push_back(event->getEventTrigger());
+		sides.push_back(event->getSide());
+		passable.push_back(event->isPassable());
+		sprites.emplace_back();
+		active.push_back(true);
+		stamps.push_back(0);
+		events.push_back(event);
+		event->attach(*this, slot);
+		return slot;
+	}
+
+	std::uint16_t EventStore::triggerBits(EventTrigger trigger, int sides) const {
+		int sideBits = (sides & (SIDE_UP | SIDE_DOWN)) | ((sides & (SIDE_LEFT | SIDE_RIGHT)) >> 2);
+		return sideBits << ((int)trigger * 4);
+	}
+
+	int EventStore::tileIndex(sf::Vector2i const &tile) const {
+		if(tile.x < 0 || tile.y < 0 || tile.x >= mapSize.x || tile.y >= mapSize.y) {
+			return -1;
+		}
+		return tile.x + tile.y * mapSize.x;
+	}
+
+	void EventStore::place(std::size_t slot, int index, int delta) {
+		if(index < 0) return;
+		std::uint16_t bits = triggerBits(triggers[slot], sides[slot]);
+		std::uint16_t *counts = &triggerCounts[index * TRIGGER_MASK_BITS];
+		for(int bit = 0; bit < TRIGGER_MASK_BITS; bit++) {
+			if(bits & (1 << bit)) {
+				counts[bit] += delta;
+				if(counts[bit] != 0) {
+					tileMasks[index] |= (1 << bit);
+				} else {
+					tileMasks[index] &= ~(1 << bit);
+				}
+			}
+		}
+		if(!passable[slot]) {
+			blockers[index] += delta;
+		}
+	}
+
+	void EventStore::updateSight(std::size_t slot, bool add) {
+		if(triggers[slot] != EventTrigger::ZONE || tileIndex(tiles[slot]) < 0) return;
+		for(Side dir : sightDirs) {
+			sf::Vector2i tile = tiles[slot];
+			for(int i = 0; i < SIGHT_RANGE; i++) {
+				tile += sightStep(dir);
+				int index = tileIndex(tile);
+				if(index < 0 || opaque[index]) break;
+				std::vector<Watcher> &tileWatchers = watchers[index];
+				if(add) {
+					tileWatchers.push_back(Watcher{slot, dir});
+				} else {
+					tileWatchers.erase(std::remove_if(tileWatchers.begin(), tileWatchers.end(), [slot](Watcher const &watcher) { return watcher.slot == slot; }), tileWatchers.end());
+				}
+			}
+		}
+	}
+
+	const std::vector<EventStore::Watcher> &EventStore::getWatchers(sf::Vector2i const &tile) const {
+		int index = tileIndex(tile);
+		return index < 0 ? noWatchers : watchers[index];
+	}
+
+	bool EventStore::hasTrigger(sf::Vector2i const &tile, EventTrigger trigger, int sides) const {
+		int index = tileIndex(tile);
+		return index >= 0 && (tileMasks[index] & triggerBits(trigger, sides)) != 0;
+	}
+
+	bool EventStore::stamp(std::size_t slot, unsigned int frame) {
+		bool recent = stamps[slot] != 0 && frame + 1 - stamps[slot] <= 1;
+		stamps[slot] = frame + 1;
+		return !recent;
+	}
+
+	void EventStore::setMapPosition(std::size_t slot, sf::Vector2i const &tile, Side dir) {
+		facing[slot] = dir;
+		if(tiles[slot] != tile) {
+			sf::Vector2i previous = tiles[slot];
+			updateSight(slot, false);
+			tiles[slot] = tile;
+			updateSight(slot, true);
+			place(slot, tileIndex(previous), -1);
+			place(slot, tileIndex(tile), 1);
+		}
+	}
+
+	bool EventStore::isBlocking(sf::Vector2i const &tile) const {
+		int index = tileIndex(tile);
+		return index >= 0 && blockers[index] != 0;
+	}
+
+	void EventStore::draw(sf::RenderTarget &target, float limit, bool above) const {
+		for(sf::Sprite const &sprite : sprites) {
+			if((sprite.getPosition().y > limit) == above) {
+				target.draw(sprite);
+			}
+		}
+	}
+
+	void EventStore::setSprite(std::size_t slot, sf::Vector2f const &position, sf::Texture const *texture) {
+		sprites[slot].setPosition(position);
+		if(texture != nullptr) {
+			sprites[slot].setTexture(*texture);
+		}
+	}
+
+	void EventStore::setTransform(std::size_t slot, sf::Vector2f const &origin, sf::Vector2f const &scale) {
+		sprites[slot].setOrigin(origin);
+		sprites[slot].setScale(scale);
+	}
+}
@@ -0,0 +1,228 @@
+/*!
+ * \file EventStore.hpp
+ * \author Cyrielle
+ * \copyright GNU GPL v3.0
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+#include <SFML/Graphics/RenderTarget.hpp>
+#include <SFML/Graphics/Sprite.hpp>
+
+#include "AbstractEvent.hpp"
+
+/*!
+ * \brief The number of bits of the trigger mask of a tile : four triggers, and four sides for each.
+ */
+#define TRIGGER_MASK_BITS 16
+
+namespace OpMon::Elements {
+
+	/*!
+	 * \brief Stores the data of the events of a map in parallel arrays.
+	 * \ingroup Events
+	 *
+	 * Each event added to the store gets a slot, and the data used every frame by the overworld (position in the map, facing,
+	 * trigger, sides, passability and sprite) is stored at the index of this slot in one array per component. The collision
+	 * checks, the lookups by position and the drawing can then iterate over one array instead of going through each event.
+	 *
+	 * The events themselves are kept in the store for their behaviour (AbstractEvent::update and AbstractEvent::action), and
+	 * write their own components into their slot when they change (see AbstractEvent::sync).
+	 *
+	 * For each tile of the map, the store also keeps a mask of the triggers and sides of the events on it (see hasTrigger), so
+	 * checking a tile without event only takes one lookup. The store counts the events setting each bit of the mask, so moving
+	 * an event only updates the bits of its old and new tiles, whatever the number of events of the map.
+	 *
+	 * The sight of the events triggered with EventTrigger::ZONE is precomputed too : when such an event changes of tile, the
+	 * tiles it can see in each direction (until an opaque tile of the map) are computed, and the event is added to the watchers
+	 * of these tiles (see getWatchers). Checking if the player is seen is then one lookup, whatever the number of events.
+	 *
+	 * The store owns the events : they are deleted with it.
+	 */
+	class EventStore {
+	public:
+		/*!
+		 * \brief An event seeing a tile when it looks in a direction.
+		 */
+		struct Watcher {
+			std::size_t slot;
+			Side dir;
+		};
+
+	private:
+		std::vector<sf::Vector2i> tiles;
+		std::vector<Side> facing;
+		std::vector<EventTrigger> triggers;
+		std::vector<int> sides;
+		std::vector<char> passable;
+		std::vector<sf::Sprite> sprites;
+		/*!
+		 * \brief If the event is in the activity region of the overworld (see Overworld::getActivityRegion).
+		 */
+		std::vector<char> active;
+		/*!
+		 * \brief The frame in which each event has been triggered for the last time, plus one. 0 means never.
+		 */
+		std::vector<unsigned int> stamps;
+		/*!
+		 * \brief The trigger mask of each tile of the map (see triggerBits).
+		 */
+		std::vector<std::uint16_t> tileMasks;
+		/*!
+		 * \brief The number of events setting each bit of the trigger mask of each tile, TRIGGER_MASK_BITS counts per tile.
+		 */
+		std::vector<std::uint16_t> triggerCounts;
+		/*!
+		 * \brief The number of non passable events on each tile of the map.
+		 */
+		std::vector<std::uint16_t> blockers;
+		/*!
+		 * \brief The size of the map, in tiles.
+		 */
+		sf::Vector2i mapSize;
+		/*!
+		 * \brief If each tile of the map stops the sight of the events.
+		 */
+		std::vector<char> opaque;
+		/*!
+		 * \brief The events seeing each tile of the map.
+		 */
+		std::vector<std::vector<Watcher>> watchers;
+		/*!
+		 * \brief The events, used for their behaviour.
+		 */
+		std::vector<AbstractEvent *> events;
+
+	public:
+		EventStore() = default;
+		EventStore(EventStore const &) = delete;
+		EventStore &operator=(EventStore const &) = delete;
+		~EventStore();
+
+		/*!
+		 * \brief Sets the size of the map, in tiles. Has to be called before adding events.
+		 */
+		void setSize(sf::Vector2i const &size);
+		/*!
+		 * \brief Sets the tiles stopping the sight of the events, one value per tile of the map. Has to be called before adding events.
+		 */
+		void setOpaque(std::vector<char> const &opaque);
+		const sf::Vector2i &getMapSize() const {
+			return mapSize;
+		}
+
+		/*!
+		 * \brief Adds an event to the store and attaches it to its new slot.
+		 * \returns The slot of the event.
+		 */
+		std::size_t add(AbstractEvent *event);
+
+		std::size_t size() const {
+			return events.size();
+		}
+
+		std::vector<AbstractEvent *> &getEvents() {
+			return events;
+		}
+		AbstractEvent *getEvent(std::size_t slot) const {
+			return events[slot];
+		}
+
+		const std::vector<sf::Vector2i> &getTiles() const {
+			return tiles;
+		}
+		const std::vector<Side> &getFacing() const {
+			return facing;
+		}
+		const std::vector<EventTrigger> &getTriggers() const {
+			return triggers;
+		}
+		const std::vector<int> &getSides() const {
+			return sides;
+		}
+		const std::vector<sf::Sprite> &getSprites() const {
+			return sprites;
+		}
+
+		/*!
+		 * \brief Returns `true` if an event on the given tile can be triggered with the given trigger from one of the given sides.
+		 * \param sides A combination of `SIDE_*` values.
+		 */
+		bool hasTrigger(sf::Vector2i const &tile, EventTrigger trigger, int sides) const;
+
+		/*!
+		 * \brief Marks the event of the given slot as triggered in the given frame.
+		 * \returns `false` if the event had already been triggered in this frame or in the previous one.
+		 */
+		bool stamp(std::size_t slot, unsigned int frame);
+
+		/*!
+		 * \brief Returns the events which can see the given tile, with the direction in which they have to look to see it.
+		 * \details The direction has to be compared with the facing of the event to know if the event really sees the tile.
+		 */
+		const std::vector<Watcher> &getWatchers(sf::Vector2i const &tile) const;
+
+		/*!
+		 * \brief Returns `true` if a non passable event is at the given position.
+		 * \details Only one lookup : the number of non passable events of each tile is updated when an event moves.
+		 */
+		bool isBlocking(sf::Vector2i const &tile) const;
+
+		/*!
+		 * \brief Draws the events on one side of a horizontal line.
+		 * \param limit The height of the line, in pixels.
+		 * \param above If `true`, draws the events strictly below the line on the screen (drawn over the player), else draws the others.
+		 */
+		void draw(sf::RenderTarget &target, float limit, bool above) const;
+
+		bool isActive(std::size_t slot) const {
+			return active[slot];
+		}
+		/*!
+		 * \brief Sets if the event in the given slot is in the activity region.
+		 * \returns `true` if the event has just become active.
+		 */
+		bool setActive(std::size_t slot, bool active) {
+			bool woken = active && !this->active[slot];
+			this->active[slot] = active;
+			return woken;
+		}
+
+		/*!
+		 * \brief Updates the position and the facing of the event in the given slot.
+		 */
+		void setMapPosition(std::size_t slot, sf::Vector2i const &tile, Side dir);
+		/*!
+		 * \brief Updates the sprite of the given slot.
+		 * \param texture The new texture, or `nullptr` to keep the current one.
+		 */
+		void setSprite(std::size_t slot, sf::Vector2f const &position, sf::Texture const *texture);
+		/*!
+		 * \brief Sets the origin and the scale of the sprite of the given slot.
+		 */
+		void setTransform(std::size_t slot, sf::Vector2f const &origin, sf::Vector2f const &scale);
+
+	private:
+		/*!
+		 * \brief Returns the bits of the tile masks set by the given event.
+		 * \details The mask has four bits per trigger, one for each side, in the order up, down, left, right.
+		 */
+		std::uint16_t triggerBits(EventTrigger trigger, int sides) const;
+		/*!
+		 * \brief Returns the index of the tile in \ref tileMasks, or -1 if the tile is outside of the map.
+		 */
+		int tileIndex(sf::Vector2i const &tile) const;
+		/*!
+		 * \brief Adds the event of the given slot to the counts of a tile, or removes it, and updates the mask and the blockers of the tile.
+		 * \param index The index of the tile, ignored if negative.
+		 * \param delta 1 to add the event, -1 to remove it.
+		 */
+		void place(std::size_t slot, int index, int delta);
+		/*!
+		 * \brief Adds the event of the given slot to the watchers of the tiles it can see from its tile, or removes it.
+		 */
+		void updateSight(std::size_t slot, bool add);
+	};
+}
@@ -0,0 +1,178 @@
+#include "ScriptEvent.hpp"
+#include "BattleEvent.hpp"
+#include "EventStore.hpp"
+#include "src/opmon/screens/overworld/Overworld.hpp"
+#include "src/opmon/core/GameData.hpp"
+#include "src/opmon/view/ui/Jukebox.hpp"
+#include "src/utils/exceptions.hpp"
+#include "src/utils/i18n/Translator.hpp"
+
+/*!
+ * \brief The maximum number of instructions executed in one frame, to avoid freezing the game with a script looping without waiting.
+ */
+#define SCRIPT_STEPS_PER_FRAME 256
+
+namespace OpMon::Elements {
+
+	ScriptEvent::ScriptEvent(OverworldData &data, nlohmann::json jsonData)
+	: CharacterEvent(data, jsonData)
+	, script(data, jsonData.at("script"), otherTextures){
+	}
+
+	void ScriptEvent::attach(EventStore &store, std::size_t slot) {
+		script.checkTiles(store.getMapSize());
+		CharacterEvent::attach(store, slot);
+	}
+
+	void ScriptEvent::action(Player &player, Overworld &overworld) {
+		if(!running) {
+			CharacterEvent::action(player, overworld);
+			running = true;
+			waiting = false;
+			pc = 0;
+		}
+	}
+
+	void ScriptEvent::update(Player &player, Overworld &overworld) {
+		CharacterEvent::update(player, overworld);
+		if(running) {
+			run(player, overworld);
+			sync();
+		}
+	}
+
+	void ScriptEvent::run(Player &player, Overworld &overworld) {
+		const std::vector<ScriptInstruction> &code = script.getCode();
+		for(unsigned int steps = 0; steps < SCRIPT_STEPS_PER_FRAME; steps++) {
+			ScriptInstruction const &instruction = code[pc];
+			switch(instruction.op) {
+			case ScriptOp::END:
+				running = false;
+				pc = 0;
+				return;
+			case ScriptOp::SET:
+				registers[instruction.a] = instruction.b;
+				break;
+			case ScriptOp::ADD:
+				registers[instruction.a] += instruction.b;
+				break;
+			case ScriptOp::LOAD_FLAG:
+				registers[instruction.a] = overworld.getData().getFlag(instruction.b);
+				break;
+			case ScriptOp::STORE_FLAG:
+				overworld.getData().getFlag(instruction.b) = registers[instruction.a];
+				break;
+			case ScriptOp::JUMP:
+				pc = instruction.b;
+				continue;
+			case ScriptOp::JUMP_IF_ZERO:
+				if(registers[instruction.a] == 0) {
+					pc = instruction.b;
+					continue;
+				}
+				break;
+			case ScriptOp::FACE:
+				mapPos.setDir((Side)instruction.a);
+				currentTexture = otherTextures.begin() + instruction.a;
+				break;
+			case ScriptOp::SOUND:
+				overworld.getData().getGameDataPtr()->getJukebox().playSound(script.getSound(instruction.a));
+				break;
+			case ScriptOp::MUSIC:
+				overworld.getData().getGameDataPtr()->getJukebox().play(script.getSound(instruction.a));
+				break;
+			default:
+				if(!runWaiting(instruction, player, overworld)) {
+					return;
+				}
+				waiting = false;
+				break;
+			}
+			pc++;
+		}
+	}
+
+	bool ScriptEvent::runWaiting(ScriptInstruction const &instruction, Player &player, Overworld &overworld) {
+		bool start = !waiting;
+		waiting = true;
+		switch(instruction.op) {
+		case ScriptOp::DIALOG:
+			if(start) {
+				overworld.startDialog(script.getDialog(instruction.a).getString(Utils::I18n::Translator::getInstance().getStringKeys()));
+				return false;
+			}
+			return overworld.isDialogOver();
+		case ScriptOp::MOVE:
+			if(start) {
+				counter = instruction.b;
+			}
+			if(mapPos.isAnim()) {
+				return false;
+			}
+			if(counter == 0) {
+				return true;
+			}
+			//If the way is blocked, the movement is tried again in the next frame.
+			if(move((Side)instruction.a, overworld.getData().getCurrentMap())) {
+				counter--;
+			}
+			return false;
+		case ScriptOp::WALK:
+			if(start) {
+				counter = 0;
+				overworld.getData().getCurrentMap()->getPathfinder().findPath(mapPos.getPosition(), sf::Vector2i(instruction.a, instruction.b), path);
+			}
+			if(mapPos.isAnim()) {
+				return false;
+			}
+			if(counter >= (int)path.size()) {
+				return true;
+			}
+			//If the way is blocked by an event, the movement is tried again in the next frame.
+			if(move(path[counter], overworld.getData().getCurrentMap())) {
+				counter++;
+			}
+			return false;
+		case ScriptOp::ANIMATE:
+			if(start) {
+				counter = 0;
+			}
+			if(instruction.a + counter / instruction.c > instruction.b) {
+				return true;
+			}
+			currentTexture = otherTextures.begin() + instruction.a + counter / instruction.c;
+			counter++;
+			return false;
+		case ScriptOp::WAIT:
+			if(start) {
+				counter = 0;
+			}
+			return counter++ >= instruction.b;
+		case ScriptOp::TELEPORT:
+			if(start) {
+				player.getPosition().lockMove();
+			}
+			if(player.getPosition().isMoving()) {
+				return false;
+			}
+			{
+				ScriptTeleport const &teleport = script.getTeleport(instruction.a);
+				overworld.tp(teleport.map, teleport.position);
+				if(teleport.side != Side::NO_MOVE) {
+					player.getPosition().setDir(teleport.side);
+				}
+				player.getPosition().justTP = true;
+				player.getPosition().unlockMove();
+			}
+			return true;
+		case ScriptOp::BATTLE:
+			if(start) {
+				script.getBattle(instruction.a)->action(player, overworld);
+				return false;
+			}
+			return script.getBattle(instruction.a)->isOver();
+		default:
+			throw Utils::UnexpectedValueException(std::to_string((int)instruction.op), "a valid instruction in ScriptEvent::runWaiting");
+		}
+	}
+}
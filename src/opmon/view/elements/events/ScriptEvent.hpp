@@ -0,0 +1,70 @@
+/*!
+ * \file ScriptEvent.hpp
+ * \author Cyrielle
+ * \copyright GNU GPL v3.0
+ */
+
+#pragma once
+
+#include "CharacterEvent.hpp"
+#include "EventScript.hpp"
+
+namespace OpMon::Elements {
+
+	/*!
+	 * \brief A character executing an EventScript when triggered.
+	 * \ingroup Events
+	 *
+	 * The script is read from the field "script" of the event's json, and compiled when the map is loaded. Each frame, the instructions
+	 * are executed until one has to wait (for the end of a dialog, of a movement...), or until SCRIPT_STEPS_PER_FRAME instructions have been executed.
+	 *
+	 * The teleportation moves the player to another map, where this event is not updated anymore : it should be the last step of a script.
+	 */
+	class ScriptEvent : public CharacterEvent {
+	private:
+		EventScript script;
+
+		/*!
+		 * \brief The index of the next instruction to execute.
+		 */
+		std::size_t pc = 0;
+		int registers[SCRIPT_REGISTERS] = {0};
+		/*!
+		 * \brief If the script is being executed.
+		 */
+		bool running = false;
+		/*!
+		 * \brief If the current instruction has been started and is waiting for its end.
+		 */
+		bool waiting = false;
+		/*!
+		 * \brief A counter used by the current instruction (remaining tiles or elapsed frames).
+		 */
+		int counter = 0;
+		/*!
+		 * \brief The path followed by the current ScriptOp::WALK instruction.
+		 */
+		std::vector<Side> path;
+
+		/*!
+		 * \brief Executes the script until an instruction has to wait.
+		 */
+		void run(Player &player, Overworld &overworld);
+		/*!
+		 * \brief Executes the current instruction if it has to wait.
+		 * \returns `true` if the instruction is over, `false` if the script has to wait for the next frame.
+		 */
+		bool runWaiting(ScriptInstruction const &instruction, Player &player, Overworld &overworld);
+
+	public:
+		ScriptEvent(OverworldData &data, nlohmann::json jsonData);
+		virtual void update(Player &player, Overworld &overworld);
+		virtual void action(Player &player, Overworld &overworld);
+		bool isOver() const {return !running && CharacterEvent::isOver();}
+		/*!
+		 * \brief Attaches the event to its slot, once the destinations of the script have been checked against the size of the map.
+		 * \throws Utils::UnexpectedValueException if the script walks out of the map.
+		 */
+		virtual void attach(EventStore &store, std::size_t slot);
+	};
+}
@@ -3,6 +3,7 @@
 #include "SoundEvent.hpp"
 #include "TPEvent.hpp"
 #include "DialogEvent.hpp"
+#include "src/opmon/screens/overworld/Overworld.hpp"
 #include <queue>
 
 namespace OpMon::Elements {
@@ -13,7 +14,7 @@ namespace OpMon::Elements {
 				new TPEvent(data.getDoorsTexture(doorType), eventTrigger, position, tpCoord, map, ppDir, sides, passable),
 				nullptr})),
 			std::queue<bool>(std::deque<bool>({false, true, false, false}))){
-		this->sprite->setOrigin(5, 6); //The doors are a bit bigger than a square (42x36 instead of 32x32).
+		mainEvent->setOrigin(sf::Vector2f(5, 6)); //The doors are a bit bigger than a square (42x36 instead of 32x32).
 	}
 
 	DoorEvent::DoorEvent(OverworldData &data, nlohmann::json jsonData)
@@ -23,7 +24,7 @@ namespace OpMon::Elements {
 				new TPEvent(data, jsonData),
 				nullptr})),
 			std::queue<bool>(std::deque<bool>({false, true, false, false}))){
-		this->sprite->setOrigin(5, 6); //The doors are a bit bigger than a square (42x36 instead of 32x32).
+		mainEvent->setOrigin(sf::Vector2f(5, 6)); //The doors are a bit bigger than a square (42x36 instead of 32x32).
 	}
 
 	void DoorEvent::update(Player &player, Overworld &overworld){
@@ -63,48 +64,60 @@ namespace OpMon::Elements {
 
 	TrainerEvent::TrainerEvent(TalkingCharaEvent* prebattlenpc, BattleEvent* battle, TalkingCharaEvent* postbattlenpc)
 	: AbstractMetaEvent(std::queue<AbstractEvent*>(std::deque<AbstractEvent*>({
-		prebattlenpc, battle, postbattlenpc
-	}))) {}
+		prebattlenpc, battle
+	})))
+	, prebattle(prebattlenpc)
+	, battle(battle)
+	, postbattle(postbattlenpc) {
+		if(postbattle != prebattle) eventQueue.push(postbattle);
+	}
 
 	TrainerEvent::TrainerEvent(OverworldData &data, nlohmann::json jsonData)
 	: AbstractMetaEvent(std::queue<AbstractEvent*>(std::deque<AbstractEvent*>({
 		new TalkingCharaEvent(data, jsonData.at("prebattle")),
 				new BattleEvent(data, jsonData.at("prebattle"))
 	}))) {
+		prebattle = (TalkingCharaEvent *) eventQueue.front();
+		battle = (BattleEvent *) eventQueue.back();
 		// If "postbattle" field doesn't exist, the post battle character is the same as the pre battle one.
-		eventQueue.push(jsonData.contains("postbattle") ? new TalkingCharaEvent(data, jsonData.at("postbattle")) : eventQueue.front());
+		if(jsonData.contains("postbattle")) {
+			postbattle = new TalkingCharaEvent(data, jsonData.at("postbattle"));
+			eventQueue.push(postbattle);
+		} else {
+			postbattle = prebattle;
+		}
 	}
 
 	void TrainerEvent::update(Player &player, Overworld &overworld){
-		eventQueue.front()->update(player, overworld); //Updates the first event in the queue.
-		if(triggered && !defeated && eventQueue.front()->isOver()){ //If the event has been triggered, not defeated yet and that the current action is over,
-																	//it means that the player has interacted with the event, so the dialog has been launched
-																	//and is now over, and the battle can now start.
-			garbage.push_back(eventQueue.front()); //Deleting the pre-battle NPC or the battle event
-			eventQueue.pop();
-			mainEvent = eventQueue.front();
-			eventQueue.front()->action(player, overworld); //Starts the battle
-
-			garbage.push_back(eventQueue.front());
-			eventQueue.pop(); //Shows the post battle npc
-			defeated = true;
-			triggered = false;
-			if(eventQueue.front()->getPositionMap().getPosition() == sf::Vector2i(0,0))            //If the position of the new event is 0,0
-				eventQueue.front()->setPosition(garbage.front()->getPositionMap().getPosition());  //sets it to the position of the pre battle event
-			mainEvent = eventQueue.front();
-		}
-
+		mainEvent->update(player, overworld);
 		AbstractMetaEvent::update(player, overworld);
 	}
 
 	void TrainerEvent::action(Player &player, Overworld &overworld){
-		eventQueue.front()->action(player, overworld); //Triggers the first event in the queue.
-		triggered = true;
+		mainEvent->action(player, overworld);
+		if(!defeated && !triggered) {
+			triggered = true;
+			overworld.getSequences().start(fight(player, overworld));
+		}
 	}
 
-	TrainerEvent::~TrainerEvent(){
-		for(AbstractEvent* event : garbage) {
-			delete(event);
+	void TrainerEvent::seen(Player &player, Overworld &overworld){
+		if(!defeated && !triggered) {
+			action(player, overworld);
 		}
 	}
+
+	Sequence TrainerEvent::fight(Player &player, Overworld &overworld){
+		co_await overworld.getDialogEnd();
+		setMainEvent(battle);
+		battle->action(player, overworld); //Starts the battle
+
+		if(postbattle->getPositionMap().getPosition() == sf::Vector2i(0,0))                 //If the position of the post battle npc is 0,0
+			postbattle->setPosition(prebattle->getPositionMap().getPosition());            //sets it to the position of the pre battle event
+		setMainEvent(postbattle); //Shows the post battle npc
+		defeated = true;
+
+		co_await battle->getEnd();
+		triggered = false;
+	}
 }
@@ -53,22 +53,32 @@ namespace OpMon::Elements {
 		 */
 		bool defeated = false;
 		/*!
-		 * \brief If `true`, the player has interacted with the event.
+		 * \brief If `true`, the player has interacted with the event and the sequence started by action is running.
 		 *
-		 * This variable is set to `false` at the end of the battle (if not defeated) or dialog (if defeated).
+		 * This variable is set to `false` at the end of the battle.
 		 */
 		bool triggered = false;
 
 		/*!
-		 * \brief Contains the pointers to the pre battle and battle events when the objects are still used somewhere in the code.
+		 * \brief The three events of the trainer. They are owned by \ref eventQueue, which contains the post battle npc only if it is not the pre battle one.
 		 */
-		std::list<AbstractEvent*> garbage;
+		TalkingCharaEvent *prebattle;
+		BattleEvent *battle;
+		TalkingCharaEvent *postbattle;
+
+		/*!
+		 * \brief The sequence started when the player talks to the trainer : waits for the end of the dialog, starts the battle, shows the post battle npc and waits for the end of the battle.
+		 */
+		Sequence fight(Player &player, Overworld &overworld);
 
 	public:
 		TrainerEvent(TalkingCharaEvent* prebattlenpc, BattleEvent* battle, TalkingCharaEvent* postbattlenpc);
 		TrainerEvent(OverworldData &data, nlohmann::json jsonData);
-		~TrainerEvent();
 		void action(Player &player, Overworld &overworld);
+		/*!
+		 * \brief Starts the fight when the player walks into the sight of the trainer, if the trainer has not been defeated yet.
+		 */
+		void seen(Player &player, Overworld &overworld);
 		void update(Player &player, Overworld &overworld);
 		bool isDefeated() {return defeated;}
 	};
@@ -9,11 +9,14 @@ File under GNU GPL v3.0 license
 #include <SFML/Graphics/Color.hpp>
 #include <SFML/Graphics/Image.hpp>
 #include <SFML/Graphics/View.hpp>
+#include <SFML/System/Clock.hpp>
+#include <SFML/System/Sleep.hpp>
 #include <SFML/System/Vector2.hpp>
 #include <SFML/Window/ContextSettings.hpp>
 #include <SFML/Window/VideoMode.hpp>
 #include <SFML/Window/WindowStyle.hpp>
-#include <algorithm> // for std::min and std::max
+#include <algorithm> // for std::min, std::max and std::clamp
+#include <cmath>
 #include <string>
 #include <vector>
 
@@ -30,6 +33,12 @@ namespace OpMon {
             if(!options.checkParam("fullscreen")) {
                 options.addOrModifParam("fullscreen", "false");
             }
+            if(!options.checkParam("presentation")) {
+                options.addOrModifParam("presentation", "scaled");
+            }
+            if(!options.checkParam("renderscale")) {
+                options.addOrModifParam("renderscale", "100");
+            }
             //settings.antialiasingLevel = 1;
             if(options.getParam("fullscreen").getValue() == "true") {
                 fullScreen = true;
@@ -42,8 +51,25 @@ namespace OpMon {
             Utils::ResourceLoader::load(icon, "opmon.png");
             window.setIcon(icon.getSize().x, icon.getSize().y, icon.getPixelsPtr());
 
-            frame.create(960, 540);
-            sprite.setTexture(frame.getTexture());
+            std::string presentation = options.getParam("presentation").getValue();
+            if(presentation == "integer") {
+                mode = PresentMode::INTEGER;
+            } else if(presentation == "direct") {
+                mode = PresentMode::DIRECT;
+            } else {
+                mode = PresentMode::SCALED;
+            }
+
+            //The frame can be smaller than the base size to make the rendering cheaper. The base view keeps the coordinates unchanged.
+            int renderScale = 100;
+            try {
+                renderScale = std::clamp(std::stoi(options.getParam("renderscale").getValue()), 25, 100);
+            } catch(std::exception &) {
+                Utils::Log::warn("Invalid renderscale option, using 100.");
+            }
+            frame.create(getBaseWindowWidth() * renderScale / 100, getBaseWindowHeight() * renderScale / 100);
+            frame.setView(getBaseView());
+            sprite.setTexture(frame.getTexture(), true);
             updateView();
 
             oplog("Window initialized!");
@@ -63,17 +89,65 @@ namespace OpMon {
             open(options);
         }
 
+        sf::RenderTarget &Window::getTarget() {
+            if(directRendering) {
+                return window;
+            }
+            return frame;
+        }
+
         void Window::refresh() {
+            if(directRendering) {
+                window.display();
+                return;
+            }
             frame.display();
             window.clear(sf::Color::Black);
             window.draw(sprite);
             window.display();
         }
 
+        bool Window::waitEvent(sf::Event &event, sf::Time timeout) {
+            sf::Clock clock;
+            while(!window.pollEvent(event)) {
+                if(clock.getElapsedTime() >= timeout) {
+                    return false;
+                }
+                sf::sleep(sf::milliseconds(10));
+            }
+            return true;
+        }
+
         void Window::updateView() {
             // unsigned int to float conversion of sizes (needed for division)
             sf::Vector2f frameSize(frame.getSize());
             sf::Vector2f windowSize(window.getSize());
+
+            directRendering = (mode == PresentMode::DIRECT && window.getSize() == sf::Vector2u(getBaseWindowWidth(), getBaseWindowHeight()));
+            if(directRendering) {
+                // the window has the base size, so the base view maps the game on the whole window
+                window.setView(getBaseView());
+                return;
+            }
+
+            // The greatest integer factor with which the frame fits in the window. The frame is shown through a viewport
+            // of exactly that size, so each pixel of the frame covers the same number of pixels of the window.
+            // If the window is smaller than the frame, there is no such factor and the frame is scaled down instead of being cropped.
+            auto coef = std::floor(std::min(windowSize.x / frameSize.x, windowSize.y / frameSize.y));
+            if(mode == PresentMode::INTEGER && coef >= 1.f) {
+                sf::Vector2f viewportSize(frameSize * coef);
+                sf::Vector2f viewportPos(std::floor((windowSize.x - viewportSize.x) / 2.f), std::floor((windowSize.y - viewportSize.y) / 2.f));
+
+                sprite.setScale(1, 1);
+                sprite.setOrigin(0, 0);
+                sprite.setPosition(0, 0);
+
+                sf::View view({0.f, 0.f, frameSize.x, frameSize.y});
+                view.setViewport({viewportPos.x / windowSize.x, viewportPos.y / windowSize.y, viewportSize.x / windowSize.x, viewportSize.y / windowSize.y});
+                window.setView(view);
+                return;
+            }
+
             auto frameRatio = frameSize.x / frameSize.y;
 
             // Computing the scaling factors : the sprite shouldn't be bigger than the screen,
@@ -99,5 +173,27 @@ namespace OpMon {
             return 540;
         }
 
+        sf::View Window::getBaseView() {
+            return sf::View(sf::FloatRect(0.f, 0.f, getBaseWindowWidth(), getBaseWindowHeight()));
+        }
+
+        Snapshot Window::snapshot(sf::RenderTarget &target) {
+            auto texture = std::make_shared<sf::Texture>();
+            if(auto *renderTexture = dynamic_cast<sf::RenderTexture *>(&target)) {
+                renderTexture->display();
+                *texture = renderTexture->getTexture();
+            } else if(auto *renderWindow = dynamic_cast<sf::RenderWindow *>(&target)) {
+                // Copies what has been drawn in the window since the last display
+                texture->create(renderWindow->getSize().x, renderWindow->getSize().y);
+                texture->update(*renderWindow);
+            }
+            return texture;
+        }
+
+        void Window::fitToScreen(sf::Sprite &sprite) {
+            sf::Vector2f textureSize(sprite.getTexture()->getSize());
+            sprite.setScale(getBaseWindowWidth() / textureSize.x, getBaseWindowHeight() / textureSize.y);
+        }
+
     } // namespace UI
 } // namespace OpMon
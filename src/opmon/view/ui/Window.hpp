@@ -10,11 +10,31 @@
 #include <SFML/Graphics/RenderTexture.hpp>
 #include <SFML/Graphics/RenderWindow.hpp>
 #include <SFML/Graphics/Sprite.hpp>
+#include <SFML/Graphics/View.hpp>
+#include <memory>
+#include <SFML/System/Time.hpp>
+#include <SFML/Window/Event.hpp>
 #include "src/utils/OptionsSave.hpp"
 
 
 namespace OpMon {
     namespace Ui {
+        /*!
+         * \brief A screenshot of the game, shared between the objects using it.
+         * \details Created by Window::snapshot. The texture is freed when the last object using it is destroyed.
+         */
+        typedef std::shared_ptr<const sf::Texture> Snapshot;
+
+        /*!
+         * \brief The different ways to show the frame of the game in the window.
+         * \details Set with the "presentation" option : "scaled", "integer" or "direct".
+         */
+        enum class PresentMode {
+            SCALED,/*!< The frame is stretched to fit the window, keeping its ratio.*/
+            INTEGER,/*!< The frame is scaled by the greatest integer factor fitting in the window, to keep the pixels sharp. If the window is smaller than the frame, SCALED is used.*/
+            DIRECT/*!< The game is drawn directly in the window if its size is the base size, without any intermediate frame. Otherwise, SCALED is used.*/
+        };
+
         /*!
          * \brief Manages and stores the objects related to the game window.
          */
@@ -34,10 +54,24 @@ namespace OpMon {
              */
             sf::Sprite sprite;
             bool fullScreen = false;
+            /*!
+             * \brief The presentation mode chosen in the options.
+             */
+            PresentMode mode = PresentMode::SCALED;
+            /*!
+             * \brief If `true`, the game is currently drawn directly in Window::window.
+             * \details Only possible in PresentMode::DIRECT, when the window has the base size. Updated in updateView().
+             */
+            bool directRendering = false;
 
           public:
             sf::RenderTexture &getFrame() { return frame; }
             sf::RenderWindow &getWindow() { return window; }
+            /*!
+             * \brief Returns the target where the game screens have to draw.
+             * \details It is Window::window when the game is directly drawn in the window, Window::frame otherwise. In both cases, its view is the base view.
+             */
+            sf::RenderTarget &getTarget();
             /*!
              * \brief Closes the window.
              */
@@ -50,6 +84,14 @@ namespace OpMon {
              * \brief Updates the Window::window with RenderTexture::frame
              */
             void refresh();
+            /*!
+             * \brief Waits for an event on Window::window, for a limited time.
+             * \details SFML's waitEvent can't be given a timeout, so the pending events are checked at regular intervals while the thread sleeps.
+             * \param event The event to fill.
+             * \param timeout The maximum time to wait.
+             * \returns `true` if an event has been received, `false` if the time is out.
+             */
+            bool waitEvent(sf::Event &event, sf::Time timeout);
             /*!
              * \brief Shortcut calling close() and open().
              */
@@ -60,6 +102,23 @@ namespace OpMon {
             void updateView();
             static int getBaseWindowWidth();
             static int getBaseWindowHeight();
+            /*!
+             * \brief Returns a view of the base size of the window.
+             * \details Whatever the real resolution of the target returned by getTarget() is, this view must be used instead of sf::RenderTarget::getDefaultView to draw on the whole screen.
+             */
+            static sf::View getBaseView();
+            /*!
+             * \brief Takes a snapshot of what has been drawn on a target returned by getTarget().
+             * \details This copies the whole screen, so it should only be called when a transition needs it, not every frame.
+             * \param target The target to copy.
+             * \returns A new snapshot of the target.
+             */
+            static Snapshot snapshot(sf::RenderTarget &target);
+            /*!
+             * \brief Scales a sprite showing a snapshot to make it cover the whole screen.
+             * \details The captures are smaller than the screen if the game is rendered at a lower resolution (see the "renderscale" option).
+             */
+            static void fitToScreen(sf::Sprite &sprite);
         };
     } // namespace Ui
 } // namespace OpMon
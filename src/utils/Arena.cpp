@@ -0,0 +1,48 @@
+/*
+Arena.cpp
+Author : Cyrielle
+File under GNU GPL v3.0
+*/
+#include "Arena.hpp"
+
+#include <algorithm>
+#include <cstdint>
+
+/**
+ * The arena set by the innermost Utils::Arena::Scope of each thread.
+ */
+static thread_local Utils::Arena *currentArena = nullptr;
+
+namespace Utils {
+
+    Arena::Arena(std::size_t blockSize)
+      : blockSize(blockSize) {}
+
+    void *Arena::allocate(std::size_t size, std::size_t alignment) {
+        std::uintptr_t address = (reinterpret_cast<std::uintptr_t>(cursor) + alignment - 1) & ~(alignment - 1);
+        if(cursor == nullptr || address + size > reinterpret_cast<std::uintptr_t>(end)) {
+            //The new block is big enough for the allocation, even if the block start has to be aligned.
+            std::size_t newSize = std::max(blockSize, size + alignment);
+            blocks.push_back(std::make_unique<std::byte[]>(newSize));
+            cursor = blocks.back().get();
+            end = cursor + newSize;
+            address = (reinterpret_cast<std::uintptr_t>(cursor) + alignment - 1) & ~(alignment - 1);
+        }
+        cursor = reinterpret_cast<std::byte *>(address + size);
+        return reinterpret_cast<void *>(address);
+    }
+
+    Arena *Arena::current() {
+        return currentArena;
+    }
+
+    Arena::Scope::Scope(Arena &arena)
+      : previous(currentArena) {
+        currentArena = &arena;
+    }
+
+    Arena::Scope::~Scope() {
+        currentArena = previous;
+    }
+
+} // namespace Utils
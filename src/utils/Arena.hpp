@@ -0,0 +1,74 @@
+/*!
+ * \file Arena.hpp
+ * \brief A monotonic memory arena.
+ * \author Cyrielle
+ * \copyright GNU GPL v3.0
+ */
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+/*! \namespace Utils
+ *  \brief Contains different utilities.
+ */
+namespace Utils {
+    /*!
+     * \class Arena "utils/Arena.hpp"
+     * \brief Allocates memory by cutting big blocks, and frees everything at once.
+     * \details The memory given by allocate() is never freed individually : it is only freed when the arena is destroyed. This makes the allocation of many small objects with the same lifetime very cheap.
+     *
+     * A class can use an arena by defining its own `operator new`, which allocates in current() if it is not `nullptr`. The current arena is set with a Scope object.
+     */
+    class Arena {
+      public:
+        /*!
+         * \param blockSize The size of the blocks allocated by the arena, in bytes. Bigger allocations get their own block.
+         */
+        explicit Arena(std::size_t blockSize = 16384);
+        Arena(Arena const &) = delete;
+        Arena &operator=(Arena const &) = delete;
+
+        /*!
+         * \brief Allocates memory in the arena.
+         * \param size The size to allocate, in bytes.
+         * \param alignment The alignment of the memory, which has to be a power of two.
+         */
+        void *allocate(std::size_t size, std::size_t alignment = alignof(std::max_align_t));
+
+        /*!
+         * \brief Returns the arena set by the innermost Scope of the current thread, or `nullptr` if there is none.
+         */
+        static Arena *current();
+
+        /*!
+         * \brief Sets the current arena of the thread while the object exists.
+         */
+        class Scope {
+          public:
+            explicit Scope(Arena &arena);
+            ~Scope();
+            Scope(Scope const &) = delete;
+            Scope &operator=(Scope const &) = delete;
+
+          private:
+            /*!
+             * \brief The current arena before the creation of the scope, restored at its destruction.
+             */
+            Arena *previous;
+        };
+
+      private:
+        std::size_t blockSize;
+        std::vector<std::unique_ptr<std::byte[]>> blocks;
+        /*!
+         * \brief The first free byte of the last block.
+         */
+        std::byte *cursor = nullptr;
+        /*!
+         * \brief The end of the last block.
+         */
+        std::byte *end = nullptr;
+    };
+} // namespace Utils
@@ -0,0 +1,79 @@
+/*!
+ * \file RingBuffer.hpp
+ * \brief A buffer keeping the last elements added.
+ * \author Cyrielle
+ * \copyright GNU GPL v3.0
+ */
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+namespace Utils {
+    /*!
+     * \class RingBuffer "utils/RingBuffer.hpp"
+     * \brief Keeps the last elements pushed, up to a fixed capacity.
+     * \details Each element pushed gets an index, which is the number of elements pushed before it. The elements are accessed with this index, so a reader can keep
+     * the index of the next element it has to read and stay valid while new elements are pushed, as long as it isn't more than getCapacity() elements late (see contains()).
+     *
+     * The memory is allocated once, in the constructor.
+     */
+    template <typename T>
+    class RingBuffer {
+      public:
+        /*!
+         * \param capacity The number of elements kept.
+         */
+        explicit RingBuffer(std::size_t capacity)
+          : items(capacity) {}
+
+        /*!
+         * \brief Adds an element, replacing the oldest one if the buffer is full.
+         */
+        void push(T const &item) {
+            items[count % items.size()] = item;
+            count++;
+        }
+
+        /*!
+         * \brief Returns the number of elements pushed since the creation of the buffer, which is also the index of the next element.
+         */
+        std::size_t getCount() const {
+            return count;
+        }
+
+        std::size_t getCapacity() const {
+            return items.size();
+        }
+
+        /*!
+         * \brief Removes all the elements.
+         * \details The indexes keep growing, so the index kept by a reader doesn't point to an element pushed after the call.
+         */
+        void clear() {
+            first = count;
+        }
+
+        /*!
+         * \brief Returns `true` if the element with the given index has been pushed and is still kept.
+         */
+        bool contains(std::size_t index) const {
+            return index >= first && index < count && index + items.size() >= count;
+        }
+
+        /*!
+         * \brief Returns the element with the given index, which has to be contained in the buffer.
+         */
+        T const &operator[](std::size_t index) const {
+            return items[index % items.size()];
+        }
+
+      private:
+        std::vector<T> items;
+        std::size_t count = 0;
+        /*!
+         * \brief The index of the first element kept since the last call to clear().
+         */
+        std::size_t first = 0;
+    };
+} // namespace Utils
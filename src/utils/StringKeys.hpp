@@ -52,6 +52,13 @@ namespace Utils {
          */
         sf::String &get(std::string key);
 
+        /*!
+         * \brief Returns `true` if the key is in the keys files, without warning if it isn't.
+         */
+        bool has(std::string const &key) {
+            return getIndex(key) >= 0;
+        }
+
         /*!
          * \brief Loads the file containing the keys and initializes the list of them.
          * \param file The file to load, containing the keys.
@@ -0,0 +1,76 @@
+/*
+WorkerPool.cpp
+Author : Cyrielle
+File under GNU GPL v3.0 license
+*/
+#include "WorkerPool.hpp"
+
+namespace Utils {
+
+    WorkerPool::WorkerPool(unsigned int workers) {
+        for(unsigned int i = 0; i < workers; i++) {
+            this->workers.emplace_back(&WorkerPool::work, this);
+        }
+    }
+
+    WorkerPool::~WorkerPool() {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            stopping = true;
+        }
+        wakeUp.notify_all();
+        for(std::thread &worker : workers) {
+            worker.join();
+        }
+    }
+
+    void WorkerPool::run(std::size_t count, std::function<void(std::size_t)> const &task) {
+        if(workers.empty() || count <= 1) {
+            for(std::size_t i = 0; i < count; i++) {
+                task(i);
+            }
+            return;
+        }
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            this->task = &task;
+            this->count = count;
+            next = 0;
+            running = workers.size();
+            generation++;
+        }
+        wakeUp.notify_all();
+        process();
+
+        std::unique_lock<std::mutex> lock(mutex);
+        done.wait(lock, [this]() { return running == 0; });
+        this->task = nullptr;
+    }
+
+    void WorkerPool::process() {
+        for(std::size_t i = next++; i < count; i = next++) {
+            (*task)(i);
+        }
+    }
+
+    void WorkerPool::work() {
+        unsigned long seen = 0;
+        while(true) {
+            {
+                std::unique_lock<std::mutex> lock(mutex);
+                wakeUp.wait(lock, [this, seen]() { return stopping || generation != seen; });
+                if(stopping) {
+                    return;
+                }
+                seen = generation;
+            }
+            process();
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                running--;
+            }
+            done.notify_one();
+        }
+    }
+
+} // namespace Utils
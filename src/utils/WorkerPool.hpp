@@ -0,0 +1,75 @@
+/*!
+ * \file WorkerPool.hpp
+ * \brief A pool of threads running parallel loops.
+ * \author Cyrielle
+ * \copyright GNU GPL v3.0
+ */
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace Utils {
+    /*!
+     * \class WorkerPool "utils/WorkerPool.hpp"
+     * \brief Keeps some threads waiting to share the iterations of a loop.
+     * \details run() calls a function for each index of a range, dividing the indexes between the workers and the calling thread, and returns when all of them have been processed.
+     * The threads are created once, in the constructor, and sleep between two calls to run().
+     */
+    class WorkerPool {
+      public:
+        /*!
+         * \param workers The number of threads created. The calling thread also works during run(), so 0 makes run() a simple loop.
+         */
+        explicit WorkerPool(unsigned int workers = std::thread::hardware_concurrency() > 1 ? std::thread::hardware_concurrency() - 1 : 0);
+        WorkerPool(WorkerPool const &) = delete;
+        WorkerPool &operator=(WorkerPool const &) = delete;
+        /*!
+         * \brief Stops and joins the threads.
+         */
+        ~WorkerPool();
+
+        /*!
+         * \brief Calls `task(i)` for each `i` in [0, count), in parallel.
+         * \details The order of the calls is not specified : the tasks must not depend on each other.
+         */
+        void run(std::size_t count, std::function<void(std::size_t)> const &task);
+
+        std::size_t getWorkerCount() const {
+            return workers.size();
+        }
+
+      private:
+        /*!
+         * \brief The loop of the threads.
+         */
+        void work();
+        /*!
+         * \brief Processes indexes of the current run until there are no more.
+         */
+        void process();
+
+        std::vector<std::thread> workers;
+        std::mutex mutex;
+        std::condition_variable wakeUp;
+        std::condition_variable done;
+
+        std::function<void(std::size_t)> const *task = nullptr;
+        std::size_t count = 0;
+        std::atomic<std::size_t> next{0};
+        /*!
+         * \brief The number of workers still processing the current run.
+         */
+        std::size_t running = 0;
+        /*!
+         * \brief Incremented at each run, to wake up the workers.
+         */
+        unsigned long generation = 0;
+        bool stopping = false;
+    };
+} // namespace Utils